@@ -0,0 +1,79 @@
+#include "AnimationClip.h"
+#include "ResourceTracker.h"
+#include <SDL3_image/SDL_image.h>
+#include <vector>
+
+// Row layout shared by all actor sheets: frame count and row offset per clip
+struct SheetLayout {
+    int frames[ClipSet::COUNT];
+    int rows[ClipSet::COUNT];
+};
+
+static const SheetLayout kDefaultLayout = {
+    // IDLE WALK ATTACK FLASH BLOCK SHOOT PLAYERCHARGE
+    {    6,   8,     9,    4,    4,    9,          12 },
+    {    0, 100,   200,  500,  400,  400,         400 },
+};
+
+// Sheets that deviate from the default layout
+struct SheetOverride {
+    const char* path;
+    SheetLayout layout;
+};
+
+static const SheetOverride kOverrides[] = {
+    // slimes have shorter walk/attack rows and flash on the block row
+    { "Assets/Sprites/slime.png", {
+        { 6,   6,   6,   4,   4,   9,  12 },
+        { 0, 100, 200, 400, 400, 400, 400 } } },
+};
+
+static std::vector<ClipSet*> sClipSets;
+
+const ClipSet* ClipSet::get(SDL_Renderer* renderer, const std::string& path, int innerW, int innerH)
+{
+    for (auto* s : sClipSets) {
+        if (s->path == path && s->clips[0].innerW == innerW && s->clips[0].innerH == innerH)
+            return s->texture ? s : nullptr;
+    }
+
+    const SheetLayout* layout = &kDefaultLayout;
+    for (const auto& o : kOverrides) {
+        if (path == o.path) { layout = &o.layout; break; }
+    }
+
+    ClipSet* set = new ClipSet();
+    set->path = path;
+    SDL_Surface* surf = renderer ? IMG_Load(path.c_str()) : nullptr;
+    if (surf) {
+        set->texture = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "ClipSet", ResourceTracker::SESSION);
+        SDL_DestroySurface(surf);
+    }
+    if (set->texture) {
+        SDL_SetTextureScaleMode(set->texture, SDL_SCALEMODE_NEAREST);
+        // enable alpha blending for sprites
+        SDL_SetTextureBlendMode(set->texture, SDL_BLENDMODE_BLEND);
+    } else {
+        SDL_Log("Failed to load sprite: %s", SDL_GetError());
+    }
+    for (int i = 0; i < COUNT; ++i) {
+        AnimationClip& c = set->clips[i];
+        c.texture = set->texture;
+        c.frameCount = layout->frames[i];
+        c.rowY = layout->rows[i];
+        c.innerW = innerW;
+        c.innerH = innerH;
+    }
+    // keep failed sheets too so a missing file is only reported once
+    sClipSets.push_back(set);
+    return set->texture ? set : nullptr;
+}
+
+void ClipSet::releaseAll()
+{
+    for (auto* s : sClipSets) {
+        if (s->texture) ResourceTracker::destroyTexture(s->texture);
+        delete s;
+    }
+    sClipSets.clear();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+
+// One row of a sprite sheet. Clips are immutable once loaded and shared by every entity
+// drawn from the same sheet; per-entity state lives in an AnimPlayhead.
+struct AnimationClip {
+    SDL_Texture* texture = nullptr;
+    int frameW = 100, frameH = 100;
+    int frameCount = 1;
+    int rowY = 0;
+    // Inner sprite inside the frame (hitbox mapping)
+    int innerX = 44, innerY = 42;
+    int innerW = 12, innerH = 16;
+
+    SDL_FRect srcRect(int frame) const { return { float(frame * frameW), float(rowY), float(frameW), float(frameH) }; }
+};
+
+// The clips of one actor sprite sheet. Every actor sheet uses the same 100x100 row layout,
+// with a few sheets overriding frame counts (see AnimationClip.cpp). A set is built the first
+// time its sheet is requested and shared until releaseAll().
+struct ClipSet {
+    enum Id : Uint8 { IDLE, WALK, ATTACK, FLASH, BLOCK, SHOOT, PLAYERCHARGE, COUNT, NONE = 0xFF };
+
+    std::string path;
+    SDL_Texture* texture = nullptr;
+    AnimationClip clips[COUNT];
+
+    const AnimationClip& operator[](Uint8 id) const { return clips[id]; }
+
+    // Shared clips for the sheet at `path` with an innerW x innerH body; nullptr if it fails to load
+    static const ClipSet* get(SDL_Renderer* renderer, const std::string& path, int innerW, int innerH);
+    static void releaseAll();
+};
+
+// Per-entity animation state: the clip being shown and how far into it we are
+struct AnimPlayhead {
+    Uint8 clip = ClipSet::IDLE;
+    Uint8 speed = 10; // ticks per frame
+    Uint8 frame = 0;
+    Uint8 timer = 0;
+
+    // Switch clip and start it from the first frame
+    void play(Uint8 id) { clip = id; frame = 0; timer = 0; }
+    // Switch clip, restarting only if it is a different one
+    void set(Uint8 id) { if (clip != id) play(id); }
+
+    void update(int frameCount)
+    {
+        if (++timer >= speed) {
+            timer = 0;
+            frame = Uint8((frame + 1) % frameCount);
+        }
+    }
+    // Same result as calling update() `ticks` times (used to catch up after sleeping)
+    void advance(int ticks, int frameCount)
+    {
+        if (ticks <= 0 || frameCount <= 0) return;
+        int step = speed > 0 ? speed : 1;
+        long long total = (long long)timer + ticks;
+        frame = Uint8((frame + total / step) % frameCount);
+        timer = Uint8(total % step);
+    }
+};
@@ -23,6 +23,13 @@ void AnimationManager::update() {
     }
 }
 
+void AnimationManager::advance(int ticks) {
+    if (ticks <= 0 || frameCount <= 0) return;
+    int step = speed > 0 ? speed : 1;
+    long long total = (long long)timer + ticks;
+    currentFrame = int((currentFrame + total / step) % frameCount);
+    timer = int(total % step);
+}
 
 void AnimationManager::setRow(int rowY, int frames) {
     animY = rowY;
@@ -1,5 +1,6 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include "ResourceTracker.h"
 
 class AnimationManager {
 public:
@@ -7,6 +8,8 @@ public:
         int innerX, int innerY, int innerW, int innerH);
 
     void update();
+    // Same result as calling update() `ticks` times (used to catch up after sleeping)
+    void advance(int ticks);
     void setRow(int rowY, int frames);
     void reset();
     void setFlip(bool flip) { flipped = flip; }
@@ -40,4 +43,6 @@ public:
     int spriteOffsetY;
     int spriteWidth;
     int spriteHeight;
+
+    ResourceTracker::Token tracked{ ResourceTracker::ANIMATION, "AnimationManager" };
 };
\ No newline at end of file
@@ -12,87 +12,88 @@ Archer::Archer(SDL_Renderer* renderer,
     int dam)
     : GameObject(renderer, spritePath, tw, th), rendererPtr(renderer)
 {
-    obj.x = startX;
-    obj.y = startY;
-    obj.damage = dam;
-    obj.attSpeed = 5;
+    tracked.setOwner("Archer");
+    spawnAt(startX, startY);
+    stats.damage = dam;
+    stats.attSpeed = 5;
     // start patrolling to the right by default
-    obj.facing = true;
-    obj.velx = 1.0f;
-    obj.avoidEdges = true;
-    audio.hitSfx = "hit";
-    audio.deathSfx = "death";
+    obj->facing = true;
+    obj->velx = 1.0f;
+    obj->avoidEdges = true;
+    audio.hitSfx = Sfx::HIT;
+    audio.deathSfx = Sfx::DEATH;
     shotFired = false;
-	obj.maxHealth = 50.0f;
-    audio.hitSfx = "orc_hit";
-    audio.deathSfx = "orc_death";
+	stats.maxHealth = 50.0f;
+    audio.hitSfx = Sfx::ORC_HIT;
+    audio.deathSfx = Sfx::ORC_DEATH;
 }
 
-void Archer::aiUpdate(Player& player, Map& map, std::vector<Arrow*>& projectiles)
+bool Archer::canSee(const Player& p, Map& map)
 {
-    if (!obj.alive) return;
+    float sx = obj->x + obj->tileWidth * 0.5f;
+    float sy = obj->y + obj->tileHeight * 0.5f;
+    float tx = p.obj->x + p.obj->tileWidth * 0.5f;
+    float ty = p.obj->y + p.obj->tileHeight * 0.5f;
+    int fromTx = int(sx / map.TILE_SIZE), fromTy = int(sy / map.TILE_SIZE);
+    int toTx = int(tx / map.TILE_SIZE), toTy = int(ty / map.TILE_SIZE);
+
+    if (losTicks > 0 && fromTx == losFromTx && fromTy == losFromTy && toTx == losToTx && toTy == losToTy)
+        return losVisible;
+
+    losVisible = map.hasLineOfSight(sx, sy, tx, ty);
+    losTicks = LOS_CACHE_TICKS;
+    losFromTx = fromTx; losFromTy = fromTy;
+    losToTx = toTx; losToTy = toTy;
+    return losVisible;
+}
+
+void Archer::spawnAt(float x, float y)
+{
+    obj->x = obj->prevX = x;
+    obj->y = obj->prevY = y;
+}
+
+void Archer::wake(int ticks)
+{
+    GameObject::wake(ticks);
+    shootCooldown = shootCooldown > ticks ? shootCooldown - ticks : 0;
+    // the player has moved since; force a fresh sight check
+    losTicks = 0;
+}
+
+void Archer::aiUpdate(Player& player, Map& map, ObjectPool<Arrow>& projectiles)
+{
+    if (!obj->alive) return;
+    if (losTicks > 0) --losTicks;
     if (knockbackTimer > 0) { GameObject::update(map); return; }
 
-    float dx = (player.obj.x) - obj.x;
-    float dy = (player.obj.y) - obj.y;
+    float dx = (player.obj->x) - obj->x;
+    float dy = (player.obj->y) - obj->y;
     float dist = std::sqrt(dx*dx + dy*dy);
 
-    // Line-of-sight check: sample along the line between archer center and player center
-    auto hasLineOfSight = [&](const Player& p, Map& m)->bool {
-        float sx = obj.x + obj.tileWidth*0.5f;
-        float sy = obj.y + obj.tileHeight*0.5f;
-        float tx = p.obj.x + p.obj.tileWidth*0.5f;
-        float ty = p.obj.y + p.obj.tileHeight*0.5f;
-        float ddx = tx - sx;
-        float ddy = ty - sy;
-        float pdist = std::sqrt(ddx*ddx + ddy*ddy);
-        if (pdist <= 0.0001f) return true;
-
-        // step a few pixels at a time; using 4px gives good coverage without being expensive
-        const float stepSize = 4.0f;
-        int steps = int(pdist / stepSize);
-        if (steps < 1) steps = 1;
-
-        for (int i = 1; i <= steps; ++i) {
-            float t = float(i) / float(steps);
-            float ix = sx + ddx * t;
-            float iy = sy + ddy * t;
-            int txi = int(ix / m.TILE_SIZE);
-            int tyi = int(iy / m.TILE_SIZE);
-
-            // Out of bounds -> treat as blocked
-            if (txi < 0 || txi >= m.width || tyi < 0 || tyi >= m.height) return false;
-
-            if (m.isSolid(txi, tyi)) return false;
-        }
-        return true;
-    };
-
     // Only attempt to start shooting if within range, has line-of-sight, cooldown expired and not already in attack
-    if (dist <= range && hasLineOfSight(player, map) && shootCooldown <= 0 && !obj.attacking)
+    if (dist <= range && canSee(player, map) && shootCooldown <= 0 && !obj->attacking)
     {
         // face the player when starting to shoot
-        obj.facing = dx > 0;
+        obj->facing = dx > 0;
 
         // start shooting animation and set attack timing
-        if (animShoot) {
-            currentAnim = animShoot;
+        if (clips) {
+            anim.play(ClipSet::SHOOT);
             // ensure animation plays at desired speed
-            currentAnim->setSpeed(obj.attSpeed);
-            currentAnim->reset();
+            anim.speed = Uint8(stats.attSpeed);
             
             // make total attack duration cover full animation
-            obj.attackTimer = currentAnim->frameCount * currentAnim->speed;
+            obj->attackTimer = Sint16(clipFrames(ClipSet::SHOOT) * anim.speed);
         } else {
             // fallback: use melee attack timing
-            obj.attackTimer = obj.attSpeed * 5;
-            currentAnim = animAttack;
-            if (currentAnim) currentAnim->reset();
+            obj->attackTimer = Sint16(stats.attSpeed * 5);
+            anim.play(ClipSet::ATTACK);
         }
 
-        obj.attacking = true;
+        obj->attacking = true;
         shotFired = false;
-        if (gSound) gSound->playSfx("monster");
+        if (gSound) gSound->playSfx(Sfx::MONSTER);
         // do not spawn arrow yet  wait until animation frame 8
     }
 
@@ -101,23 +102,23 @@ void Archer::aiUpdate(Player& player, Map& map, std::vector<Arrow*>& projectiles
     // --------------------
     // Movement intent (chase player until within shooting range)
     // Archer will move horizontally toward the player's X position while not attacking.
-    if (!obj.attacking && knockbackTimer <= 0) {
+    if (!obj->attacking && knockbackTimer <= 0) {
         // Move toward the player until the player is within Euclidean attack range.
         // Once inside range, stop moving and wait for line-of-sight to trigger the attack.
         if (dist > range) {
-            obj.velx = (dx < 0) ? -chaseSpeed : chaseSpeed;
-            obj.facing = obj.velx > 0;
+            obj->velx = (dx < 0) ? -chaseSpeed : chaseSpeed;
+            obj->facing = obj->velx > 0;
         } else {
             // inside attack range  stop moving and wait for LOS to attack
-            obj.velx = 0;
+            obj->velx = 0;
             // face the player while waiting
-            obj.facing = dx > 0;
+            obj->facing = dx > 0;
         }
-    } else if (!obj.attacking && knockbackTimer > 0) {
-        obj.facing = obj.velx > 0;
+    } else if (!obj->attacking && knockbackTimer > 0) {
+        obj->facing = obj->velx > 0;
     } else {
         // attacking: stop horizontal movement
-        obj.velx = 0;
+        obj->velx = 0;
     }
 
     // --------------------
@@ -125,24 +126,22 @@ void Archer::aiUpdate(Player& player, Map& map, std::vector<Arrow*>& projectiles
     // Updated to match GameObject::update behaviour: treat out-of-bounds and portal tiles as edges
     // and set a short knockbackTimer so AI doesn't instantly walk back onto the edge.
     // --------------------
-    if (!obj.attacking && knockbackTimer <= 0) {
-        float nextX = obj.x + obj.velx;
+    if (!obj->attacking && knockbackTimer <= 0) {
+        float nextX = obj->x + obj->velx;
 
         int l = int(nextX / map.TILE_SIZE);
-        int r = int((nextX + obj.tileWidth - 1) / map.TILE_SIZE);
-        int t = int(obj.y / map.TILE_SIZE);
-        int b = int((obj.y + obj.tileHeight - 1) / map.TILE_SIZE);
+        int r = int((nextX + obj->tileWidth - 1) / map.TILE_SIZE);
+        int t = int(obj->y / map.TILE_SIZE);
+        int b = int((obj->y + obj->tileHeight - 1) / map.TILE_SIZE);
 
         bool blocked = false;
 
-        // Wall
-        if (obj.velx > 0 && (map.isSolid(r, t) || map.isSolid(r, b)))
-            blocked = true;
-        if (obj.velx < 0 && (map.isSolid(l, t) || map.isSolid(l, b)))
+        // Wall (front column across the body's rows)
+        int frontX = obj->velx > 0 ? r : l;
+        if (obj->velx != 0 && map.overlapTiles(frontX, t, frontX, b, Map::QUERY_BLOCKING))
             blocked = true;
 
         // Ledge (tile in front & below)
-        int frontX = obj.velx > 0 ? r : l;
         int footY = b + 1;
 
         // If frontX is outside map -> consider it an edge and flip
@@ -162,8 +161,8 @@ void Archer::aiUpdate(Player& player, Map& map, std::vector<Arrow*>& projectiles
         }
 
         if (blocked) {
-            obj.facing = !obj.facing;
-            obj.velx = 0; // let next frame pick direction
+            obj->facing = !obj->facing;
+            obj->velx = 0; // let next frame pick direction
             // short pause so AI doesn't immediately override flip and move back onto the edge
             knockbackTimer = 6;
         }
@@ -172,14 +171,14 @@ void Archer::aiUpdate(Player& player, Map& map, std::vector<Arrow*>& projectiles
     // Apply physics + animation (this advances the animation frame)
     GameObject::update(map);
 
-    // While attacking and animShoot is active, check animation frame to spawn arrow on frame 8 (0-based index 7)
-    if (obj.attacking && currentAnim == animShoot && animShoot) {
-        int frame = animShoot->currentFrame; // read after update so frame reflects current visible frame
+    // While attacking and the shoot clip is active, check animation frame to spawn arrow on frame 8 (0-based index 7)
+    if (obj->attacking && anim.clip == ClipSet::SHOOT) {
+        int frame = anim.frame; // read after update so frame reflects current visible frame
         // 9 frames, index 0..8 -> fire on frame index 7 (8th frame)
         if (frame == 7 && !shotFired) {
             // recompute dx/dy to aim at current player position
-            float pdx = (player.obj.x) - obj.x;
-            float pdy = (player.obj.y) - obj.y;
+            float pdx = (player.obj->x) - obj->x;
+            float pdy = (player.obj->y) - obj->y;
             float pdist = std::sqrt(pdx*pdx + pdy*pdy);
 
             // create arrow velocity towards player with fixed speed
@@ -190,28 +189,28 @@ void Archer::aiUpdate(Player& player, Map& map, std::vector<Arrow*>& projectiles
             float vy = ny * speed;
 
             // spawn arrow slightly in front of archer
-            float sx = obj.x + (obj.facing ? obj.tileWidth : -8);
-            float sy = obj.y + obj.tileHeight * 0.5f;
+            float sx = obj->x + (obj->facing ? obj->tileWidth : -8);
+            float sy = obj->y + obj->tileHeight * 0.5f;
 
-            Arrow* a = new Arrow(rendererPtr, sx, sy, vx, vy);
-            projectiles.push_back(a);
+            // a full pool just drops the shot
+            projectiles.acquire(rendererPtr, sx, sy, vx, vy);
             shotFired = true;
         }
     }
 
     // Take damage from player's melee attack (same logic as Orc but no blocking)
-    if (player.obj.attacking) {
+    if (player.obj->attacking) {
         SDL_FRect atk = player.getAttackRect();
         SDL_FRect me = getRect();
 
         if (SDL_HasRectIntersectionFloat(&atk, &me)) {
-            float playerCenter = player.obj.x + player.obj.tileWidth * 0.5f;
+            float playerCenter = player.obj->x + player.obj->tileWidth * 0.5f;
             takeDamage(35.0f, playerCenter, 3, 6, 30, 2.5f, -4.0f);
         }
     }
 
     // When attack concludes, reset shotFired and start cooldown
-    if (!obj.attacking && shotFired) {
+    if (!obj->attacking && shotFired) {
         shotFired = false;
         shootCooldown = SHOOT_COOLDOWN_MAX;
     }
@@ -1,6 +1,7 @@
 #pragma once
 #include "GameObject.h"
 #include "Player.h"
+#include "ObjectPool.h"
 #include "Map.h"
 #include <SDL3/SDL.h>
 #include <vector>
@@ -17,8 +18,11 @@ public:
         float startY,
         int dam = 10);
 
-    // Update AI; may push new arrows into projectiles vector
-    void aiUpdate(Player& player, Map& map, std::vector<class Arrow*>& projectiles);
+    // Update AI; may spawn new arrows into the projectile pool
+    void aiUpdate(Player& player, Map& map, ObjectPool<class Arrow>& projectiles);
+    void wake(int ticks) override;
+    // Place this archer (usually a prototype clone)
+    void spawnAt(float x, float y);
 
 private:
     int shootCooldown = 0; // frames until next shot
@@ -27,4 +31,11 @@ private:
     float chaseSpeed = 1.0f; // horizontal speed when chasing player
     SDL_Renderer* rendererPtr = nullptr; // renderer for projectile creation
     bool shotFired = false; // whether arrow has been spawned in current attack animation
+
+    // Line of sight to the player, reused for a few ticks while neither end changes tile
+    bool canSee(const Player& player, Map& map);
+    const int LOS_CACHE_TICKS = 6;
+    int losTicks = 0;
+    bool losVisible = false;
+    int losFromTx = -1, losFromTy = -1, losToTx = -1, losToTy = -1;
 };
@@ -1,7 +1,9 @@
 #include "Arrow.h"
+#include "ResourceTracker.h"
 #include <SDL3_image/SDL_image.h>
 #include <cmath>
 #include "Sound.h"
+#include "Sweep.h"
 
 // Shared texture for archer arrows and trap arrows
 static SDL_Texture* s_arrowTex = nullptr;
@@ -18,7 +20,7 @@ Arrow::Arrow(SDL_Renderer* renderer, float x_, float y_, float vx, float vy, boo
             if (!s_trapArrowTex) {
                 SDL_Surface* surf = IMG_Load("Assets/Sprites/trap_arrow.png");
                 if (surf) {
-                    s_trapArrowTex = SDL_CreateTextureFromSurface(renderer, surf);
+                    s_trapArrowTex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Arrow", ResourceTracker::SESSION);
                     if (s_trapArrowTex) SDL_SetTextureScaleMode(s_trapArrowTex, SDL_SCALEMODE_NEAREST);
                     SDL_DestroySurface(surf);
                 } else {
@@ -30,7 +32,7 @@ Arrow::Arrow(SDL_Renderer* renderer, float x_, float y_, float vx, float vy, boo
             if (!s_arrowTex) {
                 SDL_Surface* surf = IMG_Load("Assets/Sprites/Arrow.png");
                 if (surf) {
-                    s_arrowTex = SDL_CreateTextureFromSurface(renderer, surf);
+                    s_arrowTex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Arrow", ResourceTracker::SESSION);
                     if (s_arrowTex) SDL_SetTextureScaleMode(s_arrowTex, SDL_SCALEMODE_NEAREST);
                     SDL_DestroySurface(surf);
                 } else {
@@ -46,7 +48,15 @@ Arrow::Arrow(SDL_Renderer* renderer, float x_, float y_, float vx, float vy, boo
 }
 
 Arrow::~Arrow() {
-    // Do not destroy shared texture here; engine will clean up renderer/tex lifecycle elsewhere
+    // Do not destroy shared texture here; Engine frees it through unloadTextures() at shutdown
+}
+
+void Arrow::unloadTextures()
+{
+    for (SDL_Texture** t : { &s_arrowTex, &s_trapArrowTex }) {
+        if (*t) ResourceTracker::destroyTexture(*t);
+        *t = nullptr;
+    }
 }
 
 void Arrow::update(Map& map)
@@ -54,23 +64,37 @@ void Arrow::update(Map& map)
     // optional travel sound handled by caller; avoid spamming audio here
     // simple physics
     prevX = x; prevY = y;
-    y += vely;
-    x += velx;
 
-    // off-map -> destroy
-    if (x < 0 || y < 0 || x > map.width * map.TILE_SIZE || y > map.height * map.TILE_SIZE) {
+    // collision with solid tiles: sweep the centre point over the whole move so a fast
+    // arrow stops at the first wall instead of skipping it; one-way tiles stop arrows too
+    SDL_FRect tip{ x + w * 0.5f - 0.5f, y + h * 0.5f - 0.5f, 1.0f, 1.0f };
+    float t = 1.0f;
+    bool hitWall = map.sweepBox(tip, velx, vely, true, t);
+    y += vely * t;
+    x += velx * t;
+    if (hitWall) {
         alive = false;
         return;
     }
 
-    // collision with solid tiles (basic): check center point
-    int tx = int((x + w*0.5f) / map.TILE_SIZE);
-    int ty = int((y + h*0.5f) / map.TILE_SIZE);
-    if (map.getCollision(tx, ty) != -1) {
+    // off-map -> destroy
+    if (x < 0 || y < 0 || x > map.width * map.TILE_SIZE || y > map.height * map.TILE_SIZE) {
         alive = false;
+        return;
     }
 }
 
+SDL_FRect Arrow::getSweptRect() const
+{
+    return sweptBounds({ prevX, prevY, (float)w, (float)h }, x - prevX, y - prevY);
+}
+
+bool Arrow::sweptHit(const SDL_FRect& target) const
+{
+    float t;
+    return sweptAABB({ prevX, prevY, (float)w, (float)h }, x - prevX, y - prevY, target, t);
+}
+
 void Arrow::draw(SDL_Renderer* renderer, int camX, int camY)
 {
     if (!alive) return;
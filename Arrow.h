@@ -1,15 +1,23 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include "Map.h"
+#include "ResourceTracker.h"
 
 class Arrow {
 public:
     Arrow(SDL_Renderer* renderer, float x, float y, float vx, float vy, bool trapSprite = false);
     ~Arrow();
 
+    // The arrow sprites are shared by every arrow; free them at shutdown
+    static void unloadTextures();
+
     void update(Map& map);
     void draw(SDL_Renderer* renderer, int camX, int camY);
     SDL_FRect getRect() const;
+    // Area covered by this tick's move, and whether that move touched `target`
+    // (hit tests use these so fast arrows cannot pass through thin targets)
+    SDL_FRect getSweptRect() const;
+    bool sweptHit(const SDL_FRect& target) const;
     bool alive = true;
     bool isTrapArrow = false;
     float prevX = 0.0f;
@@ -22,4 +30,5 @@ private:
     float velx, vely;
     int w = 19, h = 7;
     SDL_Texture* tex = nullptr;
+    ResourceTracker::Token tracked{ ResourceTracker::ENTITY, "Arrow" };
 };
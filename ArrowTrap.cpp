@@ -1,4 +1,5 @@
 #include "ArrowTrap.h"
+#include "AnimationManager.h"
 #include "Arrow.h"
 #include "Engine.h"
 #include "GameObject.h"
@@ -18,6 +19,7 @@ void ArrowTrap::triggerExternal() {
 ArrowTrap::ArrowTrap(SDL_Renderer* renderer_, int tileX, int tileY, int tileIndex)
     : MapObject(tileX, tileY, tileIndex), renderer(renderer_)
 {
+    tracked.setOwner("ArrowTrap");
     // attempt to load arrow trap animation (3 frames horizontally)
     if (gEngine && gEngine->renderer) {
         if (!loadAnimation(gEngine->renderer, "Assets/Sprites/arrow_trap.png", 16, 16, 3, 0, 0, 0, 16, 16, animPlaySpeed)) {
@@ -30,6 +32,40 @@ ArrowTrap::ArrowTrap(SDL_Renderer* renderer_, int tileX, int tileY, int tileInde
     }
 }
 
+SDL_FRect ArrowTrap::getInteractionRect()
+{
+    SDL_FRect tr = getRect();
+    if (!autoFire) return tr;
+    // same vertical band as the in-front test in update(), extended to the map edge
+    float bandY = tr.y - 8.0f;
+    float bandH = tr.h + 16.0f;
+    float worldW = gEngine ? float(gEngine->map.width * Map::TILE_SIZE) : tr.x + tr.w;
+    if (tileIndex == Map::SPAWN_ARROWTRAP_LEFT) return { 0.0f, bandY, tr.x, bandH };
+    if (tileIndex == Map::SPAWN_ARROWTRAP_RIGHT) return { tr.x + tr.w, bandY, worldW - (tr.x + tr.w), bandH };
+    return tr;
+}
+
+void ArrowTrap::wake(int ticks)
+{
+    cooldownTimer = cooldownTimer > ticks ? cooldownTimer - ticks : 0;
+}
+
+void ArrowTrap::linkPlates(const std::vector<PressurePlate*>& plates)
+{
+    watchedPlates.clear();
+    SDL_FRect tr = getRect();
+    for (auto* pp : plates) {
+        // Only consider plates roughly in front of trap (within same vertical band +/- 8 px)
+        SDL_FRect pr = pp->getRect();
+        float pCenterX = pr.x + pr.w * 0.5f;
+        float pCenterY = pr.y + pr.h * 0.5f;
+        if (pCenterY < tr.y - 8 || pCenterY > tr.y + tr.h + 8) continue;
+        if ((tileIndex == Map::SPAWN_ARROWTRAP_LEFT && pCenterX < tr.x) ||
+            (tileIndex == Map::SPAWN_ARROWTRAP_RIGHT && pCenterX > tr.x + tr.w))
+            watchedPlates.push_back(pp);
+    }
+}
+
 void ArrowTrap::update(GameObject& obj, Map& map)
 {
     if (!active) return;
@@ -45,14 +81,14 @@ void ArrowTrap::update(GameObject& obj, Map& map)
             anim->setSpeed(100000);
         }
     }
-    if (!obj.obj.alive) return;
+    if (!obj.obj->alive) return;
 
     // Determine facing from tileIndex: use map spawn constants
     bool shootLeft = (tileIndex == Map::SPAWN_ARROWTRAP_LEFT);
     bool shootRight = (tileIndex == Map::SPAWN_ARROWTRAP_RIGHT);
     if (!shootLeft && !shootRight) return;
 
-    // Trap bounds (used for plate checks below)
+    // Trap bounds (used for the in-front checks below)
     SDL_FRect tr = getRect();
     float trapLeft = tr.x;
     float trapRight = tr.x + tr.w;
@@ -62,23 +98,8 @@ void ArrowTrap::update(GameObject& obj, Map& map)
     // zone is currently triggered and it was not triggered in the previous frame, treat that
     // as a firing event (rising edge). This allows remote activation by standing on plates.
     bool plateTriggeredNow = false;
-    if (gEngine) {
-        // check all map objects for PressurePlate instances
-        for (auto* mo : gEngine->objects) {
-            if (!mo || !mo->active) continue;
-            PressurePlate* pp = dynamic_cast<PressurePlate*>(mo);
-            if (!pp) continue;
-
-            // Only consider plates roughly in front of trap (within same vertical band +/- 8 px)
-            SDL_FRect pr = pp->getRect();
-            float pCenterX = pr.x + pr.w * 0.5f;
-            float pCenterY = pr.y + pr.h * 0.5f;
-            if (pCenterY < tr.y - 8 || pCenterY > tr.y + tr.h + 8) continue;
-
-            if (shootLeft && pCenterX < trapLeft) plateTriggeredNow = plateTriggeredNow || pp->isTriggered();
-            if (shootRight && pCenterX > trapRight) plateTriggeredNow = plateTriggeredNow || pp->isTriggered();
-            if (plateTriggeredNow) break;
-        }
+    for (auto* pp : watchedPlates) {
+        if (pp->active && pp->isTriggered()) { plateTriggeredNow = true; break; }
     }
 
     // If a plate has been newly triggered (rising edge), consider that an activation event
@@ -107,20 +128,8 @@ void ArrowTrap::update(GameObject& obj, Map& map)
             float sy = tr.y + tr.h * 0.5f; // vertical center; Arrow ctor will center vertically
             int trapCenterTileX = int((tr.x + tr.w * 0.5f) / Map::TILE_SIZE);
             int spawnTileY = int(sy / Map::TILE_SIZE);
-            int foundTx = -1;
-            if (shootLeft) {
-                for (int d = 1; d <= 3; ++d) {
-                    int tx = trapCenterTileX - d;
-                    if (tx < 0) break;
-                    if (map.getCollision(tx, spawnTileY) == -1) { foundTx = tx; break; }
-                }
-            } else {
-                for (int d = 1; d <= 3; ++d) {
-                    int tx = trapCenterTileX + d;
-                    if (tx >= map.width) break;
-                    if (map.getCollision(tx, spawnTileY) == -1) { foundTx = tx; break; }
-                }
-            }
+            int foundTx = map.firstFreeTile(trapCenterTileX, spawnTileY, shootLeft ? -1 : 1, 3,
+                                            Map::QUERY_SOLID | Map::QUERY_ONEWAY);
             float sx;
             if (foundTx != -1) {
                 sx = foundTx * Map::TILE_SIZE + Map::TILE_SIZE * 0.5f - arrowW * 0.5f;
@@ -132,10 +141,8 @@ void ArrowTrap::update(GameObject& obj, Map& map)
             float vx = shootLeft ? -speed : speed;
             float vy = 0.0f;
 
-            if (gEngine) {
-                Arrow* a = new Arrow(gEngine->renderer, sx, sy, vx, vy, true); // use trap sprite
-                gEngine->projectiles.push_back(a);
-                if (gSound) gSound->playSfx("arrow");
+            if (gEngine && gEngine->projectiles.acquire(gEngine->renderer, sx, sy, vx, vy, true)) { // use trap sprite
+                if (gSound) gSound->playSfx(Sfx::ARROW);
                 SDL_Log("ArrowTrap: fired arrow from trap at tile (%d,%d)", getTileX(), getTileY());
                 // start trap firing animation (play once)
                 if (anim) {
@@ -149,7 +156,7 @@ void ArrowTrap::update(GameObject& obj, Map& map)
             cooldownTimer = cooldownTicks;
         }
         else {
-            if (gSound) gSound->playSfx("arrow_empty");
+            if (gSound) gSound->playSfx(Sfx::ARROW_EMPTY);
             // give a short cooldown so empty sound doesn't spam every frame while player remains in zone
             cooldownTimer = cooldownTicks / 2;
         }
@@ -1,6 +1,9 @@
 #pragma once
 #include "MapObject.h"
 #include "Map.h"
+#include <vector>
+
+class PressurePlate;
 
 class ArrowTrap :
     public MapObject
@@ -8,9 +11,16 @@ class ArrowTrap :
 public:
     ArrowTrap(SDL_Renderer* renderer, int tileX, int tileY, int tileIndex);
     void update(GameObject& obj, Map& map) override;
+    // auto-firing traps watch the whole band in front of them
+    SDL_FRect getInteractionRect() override;
     // Called when an external trigger (e.g., a pressure plate) wants this trap to fire
     void triggerExternal();
     void setAutoFire(bool v) { autoFire = v; }
+    // Remember the plates in this trap's firing band (once per level load)
+    void linkPlates(const std::vector<PressurePlate*>& plates);
+    // plate-linked traps can be fired from anywhere, so they never sleep
+    bool keepAwake() const override { return externalTriggered || animPlaying || !watchedPlates.empty(); }
+    void wake(int ticks) override;
 
 private:
     SDL_Renderer* renderer = nullptr;
@@ -19,6 +29,7 @@ private:
     int ammo = 200;
     bool playerWasInZone = false; // prevent firing every frame while player remains in zone
     bool plateWasTriggered = false; // track previous frame pressure-plate trigger state
+    std::vector<PressurePlate*> watchedPlates; // plates in front of the trap, any of which fires it
     bool externalTriggered = false; // set by external triggers (pressure plates)
     // Animation control: when true, play the trap's animation once then stop
     bool animPlaying = false;
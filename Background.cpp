@@ -1,4 +1,5 @@
 #include "Background.h"
+#include "ResourceTracker.h"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <cstdio>
@@ -34,6 +35,8 @@ bool Background::load(SDL_Renderer* renderer, const std::string& dir, int layers
     m_dir = dir;
     m_layers = layers;
     m_textures.resize(layers, nullptr);
+    m_widths.resize(layers, 0);
+    m_heights.resize(layers, 0);
     m_factors.resize(layers, 0.0f);
     m_hFactors.resize(layers, 0.0f);
     m_scrollOffsets.resize(layers, 0.0f);
@@ -84,7 +87,7 @@ bool Background::load(SDL_Renderer* renderer, const std::string& dir, int layers
             continue;
         }
 
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
+        SDL_Texture* tex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Background", ResourceTracker::SESSION);
         SDL_DestroySurface(surf);
         if (!tex) {
             SDL_Log("Background: texture creation failed for %s: %s", path, SDL_GetError());
@@ -96,6 +99,11 @@ bool Background::load(SDL_Renderer* renderer, const std::string& dir, int layers
         SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
 
         m_textures[i] = tex;
+
+        float fw = 0.0f, fh = 0.0f;
+        SDL_GetTextureSize(tex, &fw, &fh);
+        m_widths[i] = (int)fw;
+        m_heights[i] = (int)fh;
     }
 
     return true;
@@ -103,8 +111,11 @@ bool Background::load(SDL_Renderer* renderer, const std::string& dir, int layers
 
 void Background::unload()
 {
-    for (auto* t : m_textures) if (t) SDL_DestroyTexture(t);
+    destroyComposites();
+    for (auto* t : m_textures) if (t) ResourceTracker::destroyTexture(t);
     m_textures.clear();
+    m_widths.clear();
+    m_heights.clear();
     m_factors.clear();
     m_hFactors.clear();
     m_scrollOffsets.clear();
@@ -130,30 +141,109 @@ void Background::update(float dt)
     }
 }
 
+void Background::destroyComposites()
+{
+    for (auto* t : m_composites) if (t) ResourceTracker::destroyTexture(t);
+    m_composites.clear();
+    m_drawList.clear();
+    m_drawListKey.clear();
+}
+
+void Background::groupingKey(std::vector<float>& key) const
+{
+    // per layer: horizontal factor, vertical factor, auto-scroll flag
+    key.clear();
+    for (int i = 0; i < m_layers; ++i) {
+        float baseH = (i < (int)m_hFactors.size()) ? m_hFactors[i] : 1.0f;
+        float hMult = (i < (int)layerHMultiplier.size()) ? layerHMultiplier[i] : 1.0f;
+        float baseV = (i < (int)m_factors.size()) ? m_factors[i] : 1.0f;
+        float vMult = (i < (int)layerVMultiplier.size()) ? layerVMultiplier[i] : 1.0f;
+        key.push_back(baseH * hMult);
+        key.push_back(baseV * vMult);
+        key.push_back((i < (int)m_autoScroll.size() && m_autoScroll[i]) ? 1.0f : 0.0f);
+    }
+}
+
+void Background::rebuildDrawList(SDL_Renderer* renderer)
+{
+    groupingKey(m_keyScratch);
+    if (!m_drawList.empty() && m_keyScratch == m_drawListKey) return;
+
+    destroyComposites();
+    m_drawListKey = m_keyScratch;
+    const std::vector<float>& key = m_drawListKey;
+
+    // walk far to near, collecting runs of layers that would scroll together
+    int ii = m_layers - 1;
+    while (ii >= 0) {
+        if (!m_textures[ii] || m_widths[ii] <= 0 || m_heights[ii] <= 0) { --ii; continue; }
+
+        int first = ii;
+        std::vector<int> run{ ii };
+        bool groupable = key[ii * 3 + 2] == 0.0f;
+        int jj = ii - 1;
+        while (groupable && jj >= 0) {
+            if (!m_textures[jj]) { --jj; continue; }
+            bool same = key[jj * 3 + 2] == 0.0f
+                && key[jj * 3 + 0] == key[first * 3 + 0]
+                && key[jj * 3 + 1] == key[first * 3 + 1]
+                && m_widths[jj] == m_widths[first] && m_heights[jj] == m_heights[first];
+            if (!same) break;
+            run.push_back(jj);
+            --jj;
+        }
+
+        DrawLayer dl;
+        dl.layer = first;
+        dl.w = m_widths[first];
+        dl.h = m_heights[first];
+        dl.tex = m_textures[first];
+
+        if (run.size() > 1) {
+            SDL_Texture* comp = ResourceTracker::track(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, dl.w, dl.h), "Background", ResourceTracker::SESSION);
+            SDL_Texture* prev = SDL_GetRenderTarget(renderer);
+            if (comp && SDL_SetRenderTarget(renderer, comp)) {
+                SDL_SetRenderScale(renderer, 1.0f, 1.0f);
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+                SDL_RenderClear(renderer);
+                SDL_FRect full{ 0.0f, 0.0f, float(dl.w), float(dl.h) };
+                for (int idx : run) SDL_RenderTexture(renderer, m_textures[idx], nullptr, &full);
+                SDL_SetRenderTarget(renderer, prev);
+
+                SDL_SetTextureScaleMode(comp, SDL_SCALEMODE_NEAREST);
+                // composited onto transparent black -> premultiplied alpha
+                SDL_SetTextureBlendMode(comp, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+                m_composites.push_back(comp);
+                dl.tex = comp;
+                m_drawList.push_back(dl);
+                ii = jj;
+                continue;
+            }
+            // no render target support: fall back to drawing the layers one by one
+            SDL_Log("Background: failed to composite layers in %s: %s", m_dir.c_str(), SDL_GetError());
+            if (comp) ResourceTracker::destroyTexture(comp);
+        }
+
+        m_drawList.push_back(dl);
+        --ii;
+    }
+}
+
 void Background::draw(SDL_Renderer* renderer, int camX, int camY, int screenW, int screenH, int mapPixelHeight)
 {
     if (m_textures.empty()) return;
-    // draw furthest layers first so closer layers render on top
-    for (int ii = m_layers - 1; ii >= 0; --ii) {
-        int i = ii;
-        SDL_Texture* tex = m_textures[i];
-        if (!tex) continue;
+    rebuildDrawList(renderer);
 
-        float fw = 0.0f, fh = 0.0f;
-        SDL_GetTextureSize(tex, &fw, &fh);
-        int tw = (int)fw;
-        int th = (int)fh;
-        if (tw <= 0 || th <= 0) continue;
+    // draw list is ordered furthest first so closer layers render on top
+    for (const DrawLayer& dl : m_drawList) {
+        int i = dl.layer;
+        int tw = dl.w;
+        int th = dl.h;
 
         // horizontal parallax factor (per-layer)
-        float baseH = (i < (int)m_hFactors.size()) ? m_hFactors[i] : 1.0f;
-        float hMult = (i < (int)layerHMultiplier.size()) ? layerHMultiplier[i] : 1.0f;
-        float hFactor = baseH * hMult;
-
+        float hFactor = m_drawListKey[i * 3 + 0];
         // vertical follow factor (per-layer) - should be 1.0 for bottom alignment
-        float baseV = (i < (int)m_factors.size()) ? m_factors[i] : 1.0f;
-        float vMult = (i < (int)layerVMultiplier.size()) ? layerVMultiplier[i] : 1.0f;
-        float vFactor = baseV * vMult;
+        float vFactor = m_drawListKey[i * 3 + 1];
 
         // compute offsets
         float ox = float(camX) * hFactor;
@@ -166,17 +256,11 @@ void Background::draw(SDL_Renderer* renderer, int camX, int camY, int screenW, i
         int startX = int(-mod);
         if (startX > 0) startX -= tw;
 
-        SDL_FRect dst;
         // align bottom of texture with bottom of map (mapPixelHeight) then subtract camera Y* vFactor
+        // and let SDL repeat the texture across the screen in one call
         float baseY = float(mapPixelHeight - th);
-        dst.y = baseY - oy;
-        dst.h = (float)th;
-        for (int x = startX; x < screenW; x += tw) {
-            dst.x = (float)x;
-            dst.w = (float)tw;
-            SDL_SetRenderDrawColor(renderer, 169, 228, 238, 255);
-            SDL_RenderTexture(renderer, tex, nullptr, &dst);
-        }
+        SDL_FRect dst{ (float)startX, baseY - oy, float(screenW - startX), (float)th };
+        SDL_RenderTextureTiled(renderer, dl.tex, nullptr, 1.0f, &dst);
     }
 }
 
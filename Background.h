@@ -8,6 +8,8 @@
 // Simple reusable parallax background manager
 // It loads N layers named "1.png", "2.png", ... from a directory
 // and draws them with configurable parallax factors.
+// Each visible layer is a single tiled draw; adjacent layers that scroll identically
+// (same parallax factors, same size, no auto-scroll) are pre-composited into one texture.
 class Background {
 public:
     Background();
@@ -45,7 +47,26 @@ public:
     inline static const std::array<float, 7> DEFAULT_LAYER_V_MULT = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
 
 private:
+    // One entry per draw: either a single layer or a pre-composited group of layers
+    struct DrawLayer {
+        SDL_Texture* tex = nullptr;
+        int layer = 0;   // layer whose parallax/scroll settings apply
+        int w = 0, h = 0;
+    };
+
+    // Effective per-layer settings that decide how layers can be grouped
+    void groupingKey(std::vector<float>& key) const;
+    // Rebuild m_drawList (and composites) when the effective settings change
+    void rebuildDrawList(SDL_Renderer* renderer);
+    void destroyComposites();
+
     std::vector<SDL_Texture*> m_textures;
+    std::vector<int> m_widths;     // texture sizes cached at load
+    std::vector<int> m_heights;
+    std::vector<DrawLayer> m_drawList;        // far to near
+    std::vector<SDL_Texture*> m_composites;   // owned group textures
+    std::vector<float> m_drawListKey;         // groupingKey() the draw list was built for
+    std::vector<float> m_keyScratch;          // reused each frame to detect setting changes
     std::vector<float> m_factors; // vertical parallax factor per layer (0..1)
     std::vector<float> m_hFactors; // horizontal parallax factor per layer (0..1)
     std::vector<float> m_scrollOffsets; // autonomous horizontal scroll offsets (pixels)
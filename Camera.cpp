@@ -1,4 +1,5 @@
 #include "Camera.h"
+#include "Random.h"
 #include <cmath>
 #include <cstdlib>
 
@@ -56,8 +57,8 @@ void Camera::update(float playerX, float playerY, int mapWidth, int screenWidth,
         int curMag = int(std::round(shakeMag * progress));
         if (curMag < 1) curMag = 1;
         // random offset in [-curMag, curMag]
-        offsetX = (std::rand() % (curMag * 2 + 1)) - curMag;
-        offsetY = (std::rand() % (curMag * 2 + 1)) - curMag;
+        offsetX = gRng.camera.range(-curMag, curMag);
+        offsetY = gRng.camera.range(-curMag, curMag);
 
         --shakeTicksLeft;
     }
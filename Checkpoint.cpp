@@ -3,22 +3,13 @@
 #include "GameObject.h"
 #include "Engine.h"
 #include "Map.h"
-#include <SDL3_Image/SDL_image.h>
 #include <SDL3/SDL.h>
 #include <iostream>
 
-// Helper to create texture using engine renderer
-static SDL_Texture* loadTexture(SDL_Renderer* renderer, const std::string& path) {
-    SDL_Surface* surf = IMG_Load(path.c_str());
-    if (!surf) return nullptr;
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_DestroySurface(surf);
-    return tex;
-}
-
 Checkpoint::Checkpoint(int tileX, int tileY, int tileIndex)
     : MapObject(tileX, tileY, tileIndex)
 {
+    tracked.setOwner("Checkpoint");
     // Sprite is taller and wider than a tile: use 32x64
     w = 32;
     h = 64;
@@ -30,12 +21,11 @@ Checkpoint::Checkpoint(int tileX, int tileY, int tileIndex)
     SDL_Renderer* rend = nullptr;
     if (gEngine) rend = gEngine->renderer;
     if (rend) {
-        animTexture = loadTexture(rend, "Assets/Sprites/checkpoint.png");
+        animTexture = levelTexture(rend, "Assets/Sprites/checkpoint.png");
         if (animTexture) {
-            SDL_SetTextureScaleMode(animTexture, SDL_SCALEMODE_NEAREST);
-            SDL_SetTextureBlendMode(animTexture, SDL_BLENDMODE_BLEND);
             // 3 frames horizontally, each 32x64
-            anim = new AnimationManager(animTexture, 32, 64, 3, 0, 0, 0, 32, 64);
+            anim = gEngine->levelArena.make<AnimationManager>(animTexture, 32, 64, 3, 0, 0, 0, 32, 64);
+            anim->tracked.setOwner("Checkpoint");
             // default to showing first frame only (index 0)
             anim->currentFrame = 0;
             anim->timer = 0;
@@ -46,11 +36,7 @@ Checkpoint::Checkpoint(int tileX, int tileY, int tileIndex)
     }
 }
 
-Checkpoint::~Checkpoint()
-{
-    if (anim) { delete anim; anim = nullptr; }
-    if (animTexture) { SDL_DestroyTexture(animTexture); animTexture = nullptr; }
-}
+Checkpoint::~Checkpoint() = default;
 
 void Checkpoint::markActivated()
 {
@@ -62,7 +48,7 @@ void Checkpoint::update(GameObject& obj, Map& map)
     // only respond to the player
     if (!gEngine || !gEngine->player) return;
     if (&obj != gEngine->player) return;
-    if (!gEngine->player->obj.alive) return;
+    if (!gEngine->player->obj->alive) return;
 
     SDL_FRect pr = gEngine->player->getRect();
     SDL_FRect cr = getRect();
@@ -87,7 +73,7 @@ void Checkpoint::update(GameObject& obj, Map& map)
                 anim->setSpeed(100000);
             }
 
-            if (gSound) gSound->playSfx("lock_open");
+            if (gSound) gSound->playSfx(Sfx::LOCK_OPEN);
             SDL_Log("Checkpoint activated at level %d (%d,%d)", gEngine ? gEngine->lastCheckpointLevel : -1, tx, ty);
         }
     }
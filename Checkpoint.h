@@ -8,6 +8,8 @@ public:
 
     void update(GameObject& obj, Map& map) override;
     void draw(SDL_Renderer* renderer, int camX, int camY, const Map& map) const override;
+    // frames are picked by update(), never by the animation timer
+    void wake(int) override {}
 
     void setLevel(int level) { levelID = level; }
     void markActivated();
@@ -1 +1,114 @@
 #include "CollisionManager.h"
+#include "Player.h"
+#include "EnemyState.h"
+#include "Door.h"
+#include "Crate.h"
+#include <algorithm>
+
+static float overlapX(const SDL_FRect& a, const SDL_FRect& b)
+{
+    return std::min(a.x + a.w, b.x + b.w) - std::max(a.x, b.x);
+}
+
+static float overlapY(const SDL_FRect& a, const SDL_FRect& b)
+{
+    return std::min(a.y + a.h, b.y + b.h) - std::max(a.y, b.y);
+}
+
+// Snap `a` beside `b` on the side it came from; movedX == 0 decides by centres
+static void pushOutX(GameObject& a, const SDL_FRect& b, float movedX)
+{
+    bool toLeft;
+    if (movedX > 0.0f) toLeft = true;
+    else if (movedX < 0.0f) toLeft = false;
+    else {
+        SDL_FRect ar = a.getRect();
+        toLeft = ar.x + ar.w * 0.5f < b.x + b.w * 0.5f;
+    }
+    a.obj->x = toLeft ? b.x - a.obj->tileWidth : b.x + b.w;
+    a.obj->velx = 0.0f;
+}
+
+// Move `a` sideways by up to dx without entering solid tiles
+static void nudgeX(GameObject& a, float dx, const Map& map)
+{
+    SDL_FRect box{ a.obj->x, a.obj->y, float(a.obj->tileWidth), float(a.obj->tileHeight) };
+    map.sweepX(box, dx);
+    a.obj->x += dx;
+}
+
+// Split the horizontal overlap of two enemies between them
+static void separate(GameObject& a, GameObject& b, const Map& map)
+{
+    SDL_FRect ar = a.getRect();
+    SDL_FRect br = b.getRect();
+    float push = overlapX(ar, br) * 0.5f;
+    if (push <= 0.0f) return;
+    float dir = (ar.x + ar.w * 0.5f <= br.x + br.w * 0.5f) ? -1.0f : 1.0f;
+    nudgeX(a, dir * push, map);
+    nudgeX(b, -dir * push, map);
+}
+
+void CollisionManager::resolve(Player* player, const EnemyState& enemies, const SDL_FRect& area, SpatialHash& broadphase, const Map& map)
+{
+    activeArea = area;
+    if (player && player->obj->alive) resolveActor(*player, true, broadphase, map);
+    for (int i = 0; i < enemies.size(); ++i)
+        if (enemies.awake[i] && enemies.actor[i]->obj->alive) resolveActor(*enemies.actor[i], false, broadphase, map);
+}
+
+void CollisionManager::resolveActor(GameObject& actor, bool isPlayer, SpatialHash& broadphase, const Map& map)
+{
+    broadphase.query(actor.getRect(), SpatialHash::ENEMY | SpatialHash::DOOR | SpatialHash::CRATE, contacts);
+
+    float movedX = actor.obj->x - actor.obj->prevX;
+    // contacts come back in insertion order, so an enemy only separates from enemies
+    // listed after itself and every pair is handled once
+    bool pastSelf = isPlayer;
+    for (auto* e : contacts) {
+        if (e->actor == &actor) { pastSelf = true; continue; }
+
+        SDL_FRect ar = actor.getRect();
+        if (e->actor) {
+            GameObject& other = *e->actor;
+            if (!other.obj->alive) continue;
+            SDL_FRect orr = other.getRect();
+            if (!SDL_HasRectIntersectionFloat(&ar, &orr)) continue;
+            if (isPlayer) {
+                pushOutX(actor, orr, movedX);
+                movedX = 0.0f;
+            }
+            else if (pastSelf && SDL_HasRectIntersectionFloat(&orr, &activeArea)) {
+                // a sleeping neighbour stays put; it is separated once it wakes up
+                separate(actor, other, map);
+            }
+            continue;
+        }
+
+        MapObject* mo = e->object;
+        if (!mo->active) continue;
+        SDL_FRect br = mo->getRect();
+        if (!SDL_HasRectIntersectionFloat(&ar, &br)) continue;
+
+        if (e->kind == SpatialHash::DOOR) {
+            if (static_cast<Door*>(mo)->isOpen()) continue;
+            pushOutX(actor, br, movedX);
+        }
+        else {
+            // landing if the actor came from above (small tolerance) or mostly overlaps vertically
+            float prevBottom = actor.obj->prevY + actor.obj->tileHeight;
+            if (prevBottom <= br.y + 6.0f || overlapY(ar, br) <= overlapX(ar, br)) {
+                actor.obj->y = br.y - actor.obj->tileHeight;
+                actor.obj->vely = 0.0f;
+                actor.obj->onGround = true;
+                // ride along with a sliding crate
+                actor.obj->x += static_cast<Crate*>(mo)->velx;
+            }
+            else {
+                pushOutX(actor, br, movedX);
+            }
+        }
+        // resolved: any further contact this tick is decided by centres
+        movedX = 0.0f;
+    }
+}
@@ -1,5 +1,34 @@
 #pragma once
-class CollisionManager
-{
-};
+#include <SDL3/SDL.h>
+#include <vector>
+#include "SpatialHash.h"
+
+class GameObject;
+class Player;
+class EnemyState;
+class Map;
+
+// Entity-vs-entity contact resolution.
+// Runs once per tick after every actor has moved. Contacts are gathered through the
+// broadphase (which must be rebuilt first) and resolved in one pass with one set of rules:
+//  - the player is pushed out of live enemies
+//  - every actor is pushed out of closed doors
+//  - every actor stands on a crate it lands on, otherwise is pushed out sideways;
+//    only attacks move crates, walking into one just blocks
+//  - overlapping enemies are separated, each taking half of the overlap
+// Sleeping enemies (outside the activation area) skip physics, so they are never resolved
+// or pushed; the player is still pushed out of them.
+// Push-outs go back the way the actor came this tick (obj->prevX), or away from the other
+// body's centre when it did not move horizontally.
+class CollisionManager {
+public:
+    // `enemies` must be the EnemyState the broadphase was just rebuilt from;
+    // `activeArea` is the activation area its awake flags were computed against
+    void resolve(Player* player, const EnemyState& enemies, const SDL_FRect& activeArea, SpatialHash& broadphase, const Map& map);
 
+private:
+    void resolveActor(GameObject& actor, bool isPlayer, SpatialHash& broadphase, const Map& map);
+
+    std::vector<SpatialHash::Entry*> contacts; // scratch list for broadphase queries
+    SDL_FRect activeArea{ 0, 0, 0, 0 };        // for the current resolve() call
+};
@@ -10,6 +10,8 @@
 Crate::Crate(int tileX, int tileY, int tileIndex)
     : MapObject(tileX, tileY, tileIndex)
 {
+    tracked.setOwner("Crate");
+    broadphaseKind = SpatialHash::CRATE;
     // crates are tile-sized by default, but allow slightly different physics
     w = Map::TILE_SIZE;
     h = Map::TILE_SIZE;
@@ -52,50 +54,19 @@ void Crate::update(GameObject& player, Map& map)
     velx *= FRICTION;
     if (fabs(velx) < 0.01f) velx = 0.0f;
 
-    // Move horizontally and resolve collisions with map
-    x += velx;
-    int leftTile = int(x / Map::TILE_SIZE);
-    int rightTile = int((x + w - 1) / Map::TILE_SIZE);
-    int topTile = int(y / Map::TILE_SIZE);
-    int bottomTile = int((y + h - 1) / Map::TILE_SIZE);
-
-    if (velx > 0) {
-        int colTop = map.getCollision(rightTile, topTile);
-        int colBottom = map.getCollision(rightTile, bottomTile);
-        if ((colTop != -1 && colTop != Map::COLL_ONEWAY) || (colBottom != -1 && colBottom != Map::COLL_ONEWAY)) {
-            x = rightTile * Map::TILE_SIZE - w;
-            velx = 0.0f;
-        }
-    } else if (velx < 0) {
-        int colTop = map.getCollision(leftTile, topTile);
-        int colBottom = map.getCollision(leftTile, bottomTile);
-        if ((colTop != -1 && colTop != Map::COLL_ONEWAY) || (colBottom != -1 && colBottom != Map::COLL_ONEWAY)) {
-            x = (leftTile + 1) * Map::TILE_SIZE;
-            velx = 0.0f;
-        }
-    }
+    // Move horizontally and resolve collisions with map (swept, so hard kicks stop at walls)
+    float dx = velx;
+    if (map.sweepX(getRect(), dx)) velx = 0.0f;
+    x += dx;
 
     // Move vertically and resolve collisions
     float prevY = y;
-    y += vely;
-    topTile = int(y / Map::TILE_SIZE);
-    bottomTile = int((y + h - 1) / Map::TILE_SIZE);
+    float dy = vely;
+    bool hitY = map.sweepY(getRect(), dy);
+    y += dy;
 
     if (vely > 0) {
-        int colLeft = map.getCollision(leftTile, bottomTile);
-        int colRight = map.getCollision(rightTile, bottomTile);
-        auto shouldStopOn = [&](int col) -> bool {
-            if (col == -1) return false;
-            if (col == Map::COLL_ONEWAY) {
-                float platformTop = float(bottomTile * map.TILE_SIZE);
-                float prevBottom = prevY + h - 1;
-                if (prevBottom <= platformTop) return true;
-                return false;
-            }
-            return true;
-        };
-        if (shouldStopOn(colLeft) || shouldStopOn(colRight)) {
-            y = bottomTile * Map::TILE_SIZE - h;
+        if (hitY) {
             vely = 0.0f;
             onGround = true;
         } else {
@@ -104,10 +75,8 @@ void Crate::update(GameObject& player, Map& map)
             if (gEngine) {
                 bool landedOnPlate = false;
                 float currBottom = y + h;
-                for (auto* mo : gEngine->objects) {
-                    if (!mo || !mo->active) continue;
-                    PressurePlate* pp = dynamic_cast<PressurePlate*>(mo);
-                    if (!pp) continue;
+                for (auto* pp : gEngine->plates) {
+                    if (!pp->active) continue;
                     SDL_FRect pr = pp->getRect();
                     float plateTop = pr.y + (pr.h - 2.0f);
                     // horizontal overlap check
@@ -128,17 +97,7 @@ void Crate::update(GameObject& player, Map& map)
             }
         }
     } else if (vely < 0) {
-        int colLeftTop = map.getCollision(leftTile, topTile);
-        int colRightTop = map.getCollision(rightTile, topTile);
-        auto isSolidCeil = [&](int col) -> bool {
-            if (col == -1) return false;
-            if (col == Map::COLL_ONEWAY) return false;
-            return true;
-        };
-        if (isSolidCeil(colLeftTop) || isSolidCeil(colRightTop)) {
-            y = (topTile + 1) * Map::TILE_SIZE;
-            vely = 0.0f;
-        }
+        if (hitY) vely = 0.0f;
     }
 
     // Interaction with player attack: if player attack rect intersects crate, apply push
@@ -146,7 +105,7 @@ void Crate::update(GameObject& player, Map& map)
     SDL_FRect pr = player.getRect();
     SDL_FRect atk = player.getAttackRect();
     SDL_FRect cr = getRect();
-    if (player.obj.attacking && SDL_HasRectIntersectionFloat(&atk, &cr) && hitInvuln == 0) {
+    if (player.obj->attacking && SDL_HasRectIntersectionFloat(&atk, &cr) && hitInvuln == 0) {
         // push crate away from player
         float centerPlayer = atk.x + atk.w * 0.5f;
         float centerCrate = cr.x + cr.w * 0.5f;
@@ -156,7 +115,7 @@ void Crate::update(GameObject& player, Map& map)
         // small upward nudge if on ground
         if (onGround) vely = -3.0f;
         hitInvuln = 8; // short invuln so holding attack doesn't keep reapplying
-        if (gSound) gSound->playSfx("clang", 128, false);
+        if (gSound) gSound->playSfx(Sfx::CLANG, 128, false);
     }
     }
 
@@ -14,6 +14,7 @@ public:
     SDL_FRect getRect() { return { x, y, float(w), float(h) }; }
 
     bool isSolid() const override { return true; }
+    void wake(int ticks) override { hitInvuln = hitInvuln > ticks ? hitInvuln - ticks : 0; }
 
     bool movable = true; // can be pushed
     // Physics
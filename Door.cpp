@@ -1,4 +1,5 @@
 #include "Door.h"
+#include "AnimationManager.h"
 #include "GameObject.h"
 #include "Player.h"
 #include "Map.h"
@@ -9,6 +10,8 @@
 Door::Door(int tileX, int tileY, int tileIndex)
     : MapObject(tileX, tileY, tileIndex)
 {
+    tracked.setOwner("Door");
+    broadphaseKind = SpatialHash::DOOR;
     // door is 32x48 pixels per request
     w = 32;
     h = 48;
@@ -28,7 +31,7 @@ void Door::open(bool playSound)
         anim->currentFrame = std::max(0, anim->frameCount - 1);
         anim->timer = 0;
     }
-    if (playSound && gSound) gSound->playSfx("door_open", 128, false);
+    if (playSound && gSound) gSound->playSfx(Sfx::DOOR_OPEN, 128, false);
 
     // record persistence with engine if available and level set
     if (gEngine && level != -1) {
@@ -58,7 +61,7 @@ void Door::update(GameObject& obj, Map& map)
 
     bool touching = SDL_HasRectIntersectionFloat(&playerRect, &doorRect);
 
-    Player* p = dynamic_cast<Player*>(&obj);
+    Player* p = (gEngine && &obj == gEngine->player) ? gEngine->player : nullptr;
     if (!p) {
         // do not update wasPlayerTouching for non-player callers to avoid
         // overwriting the player's edge state (other objects like orcs call this too)
@@ -71,13 +74,13 @@ void Door::update(GameObject& obj, Map& map)
     if (edgeTouch) {
         if (p->hasKey) {
             // play lock open SFX and consume key
-            if (gSound) gSound->playSfx("lock_open", 128, false);
+            if (gSound) gSound->playSfx(Sfx::LOCK_OPEN, 128, false);
             p->hasKey = false;
             unlocked = true; // allow animation to continue even if player leaves
             SDL_Log("Player touched door at level %d (%d,%d): key consumed, door unlocked", level, tx, ty);
         } else {
             // play lock fail SFX
-            if (gSound) gSound->playSfx("lock_fail", 128, false);
+            if (gSound) gSound->playSfx(Sfx::LOCK_FAIL, 128, false);
             SDL_Log("Player touched locked door at level %d (%d,%d) without key", level, tx, ty);
         }
     }
@@ -102,6 +105,18 @@ void Door::update(GameObject& obj, Map& map)
     wasPlayerTouching = touching;
 }
 
+void Door::wake(int ticks)
+{
+    if (!anim || !unlocked || opened || ticks <= 0) return;
+    // same frame steps update() would have taken, stopping on the last frame
+    int step = anim->speed > 0 ? anim->speed : 1;
+    long long total = (long long)anim->timer + ticks;
+    long long frame = anim->currentFrame + total / step;
+    anim->timer = int(total % step);
+    if (frame >= anim->frameCount - 1) open(true);
+    else anim->currentFrame = int(frame);
+}
+
 void Door::draw(SDL_Renderer* renderer, int camX, int camY, const Map& map) const
 {
     if (!active) return;
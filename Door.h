@@ -13,6 +13,12 @@ public:
     void open(bool playSound = true);
 
     bool isOpen() const { return opened || unlocked; }
+    // finish the opening animation even after the player walks away
+    bool keepAwake() const override { return unlocked && !opened; }
+    // only an unlocked door plays its opening frames; locked and opened doors keep their frame
+    void wake(int ticks) override;
+    // closed doors block AI movement and sight
+    bool isSolid() const override { return !isOpen(); }
 
     // Engine must call this to set the level the door belongs to
     void setLevel(int levelID) { level = levelID; }
@@ -0,0 +1,62 @@
+#include "EnemyState.h"
+#include "SpatialHash.h"
+#include "Orc.h"
+#include "Archer.h"
+
+void EnemyState::clear()
+{
+    // keep capacity: this runs every tick
+    actor.clear();
+    kind.clear();
+    slot.clear();
+    atkX.clear(); atkY.clear(); atkW.clear(); atkH.clear();
+    awake.clear();
+}
+
+void EnemyState::gather(const std::vector<Orc*>& orcs, const std::vector<Archer*>& archers)
+{
+    clear();
+    for (auto* o : orcs) if (o) add(o, SpatialHash::ORC);
+    for (auto* a : archers) if (a) add(a, SpatialHash::ARCHER);
+}
+
+void EnemyState::add(GameObject* e, Uint8 k)
+{
+    actor.push_back(e);
+    kind.push_back(k);
+    slot.push_back(e->obj.index());
+    atkX.push_back(0); atkY.push_back(0); atkW.push_back(0); atkH.push_back(0);
+    awake.push_back(0);
+    readAttack(size() - 1);
+}
+
+void EnemyState::refresh()
+{
+    for (int i = 0; i < size(); ++i)
+        if (awake[i]) readAttack(i);
+}
+
+SDL_FRect EnemyState::body(int i) const
+{
+    return GameObject::bodyRect(GameObject::hot(slot[i]));
+}
+
+void EnemyState::readAttack(int i)
+{
+    SDL_FRect atk = actor[i]->getAttackRect();
+    atkX[i] = atk.x; atkY[i] = atk.y; atkW[i] = atk.w; atkH[i] = atk.h;
+}
+
+void EnemySystems::markAwake(EnemyState& s, const SDL_FRect& area)
+{
+    const float x0 = area.x, x1 = area.x + area.w;
+    const float y0 = area.y, y1 = area.y + area.h;
+    const int n = s.size();
+    const int* slot = s.slot.data();
+    Uint8* awake = s.awake.data();
+    // branch-free test on the live hot blocks; a level's enemies sit in neighbouring slots
+    for (int i = 0; i < n; ++i) {
+        SDL_FRect r = GameObject::bodyRect(GameObject::hot(slot[i]));
+        awake[i] = Uint8((r.x < x1) & (r.x + r.w > x0) & (r.y < y1) & (r.y + r.h > y0));
+    }
+}
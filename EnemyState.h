@@ -0,0 +1,43 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+class GameObject;
+class Orc;
+class Archer;
+
+// Per-tick index of the level's enemies. Position, velocity, flags and timers are not
+// copied: each entry keeps the enemy's slot in the GameObject hot store, which is the one
+// place AI and physics write them, so passes here always read current values. Only the
+// attack hitbox, which depends on per-class state, is cached; broadphase rebuilds refresh()
+// it for awake enemies. Index order is orcs then archers, in spawn order. Gather again after
+// enemies are added or removed; the arrays hold plain pointers.
+class EnemyState {
+public:
+    void gather(const std::vector<Orc*>& orcs, const std::vector<Archer*>& archers);
+    // Re-read the attack hitboxes of awake enemies after they moved this tick
+    void refresh();
+    void clear();
+
+    int size() const { return (int)actor.size(); }
+    // Body rect straight from the hot store (same as actor[i]->getRect())
+    SDL_FRect body(int i) const;
+    SDL_FRect attack(int i) const { return { atkX[i], atkY[i], atkW[i], atkH[i] }; }
+
+    std::vector<GameObject*> actor;
+    std::vector<Uint8> kind;                // SpatialHash::ORC / SpatialHash::ARCHER
+    std::vector<int> slot;                  // hot store index (GameObject::hot)
+    std::vector<float> atkX, atkY, atkW, atkH; // attack hitbox, zero-sized when not striking
+    // inside the activation area this tick (EnemySystems::markAwake); refresh() keeps it
+    std::vector<Uint8> awake;
+
+private:
+    void add(GameObject* e, Uint8 kind);
+    void readAttack(int i);
+};
+
+// Passes over EnemyState
+namespace EnemySystems {
+    // Mark every enemy whose body touches `area` awake and the rest asleep
+    void markAwake(EnemyState& s, const SDL_FRect& area);
+}
@@ -9,12 +9,16 @@
 #include "Door.h"
 #include "Potion.h"
 #include "Checkpoint.h"
+#include "GlyphAtlas.h"
+#include "SpawnRegistry.h"
+#include "ResourceTracker.h"
 // #include "Water.h"
 #include "PressurePlate.h"
 #include <SDL3/SDL.h>
 #include <cstdio>
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include "fallingplatform.h"
@@ -115,7 +119,9 @@ Engine::Engine()
     }
 
     // Create HUD
-    hud = new Hud(renderer, "Assets/Sprites/heart.png");
+    hud = new Hud(renderer, "Assets/Sprites/heart.png", VIEW_SCALE);
+    Potion::loadTextures(renderer);
+    prototypes.build(renderer);
 
     // Create Sound manager
     sound = new Sound();
@@ -195,7 +201,7 @@ Engine::Engine()
     }
 
     // Create InfoText (used for in-world hints). Use BoldPixels.ttf as requested.
-    infoText = new InfoText(renderer, "Assets/Fonts/BoldPixels.ttf", 16);
+    infoText = new InfoText(renderer, "Assets/Fonts/BoldPixels.ttf", 16, VIEW_SCALE);
     // No explicit trigger rect or fade is set here — InfoText uses spawn tile id (default 5)
     // Set preferred sizes for certain icons (e.g. keyboard icons that are 32x16)
     infoText->setIconPreferredSize("Assets/Icons/jump_kb.png", 32, 16);
@@ -221,6 +227,16 @@ Engine::~Engine()
     for (auto* b : backgrounds) delete b;
     backgrounds.clear();
 
+    // shared font atlases (menu, game over, info text)
+    GlyphAtlas::releaseAll();
+    // shared actor sprite sheets (prototypes first, they hold clip pointers)
+    prototypes.release();
+    ClipSet::releaseAll();
+    map.unloadAnimatedTiles();
+    Potion::unloadTextures();
+    Arrow::unloadTextures();
+    ResourceTracker::shutdownReport();
+
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
@@ -233,12 +249,70 @@ Engine::~Engine()
 
 void Engine::cleanupObjects()
 {
-    delete player; player = nullptr;
-    for (auto* o : orc) delete o; orc.clear();
-    for (auto* a : archers) delete a; archers.clear();
-    for (auto* f : fallT) delete f; fallT.clear();
-    for (auto* o : objects) delete o; objects.clear();
-    for (auto* p : projectiles) delete p; projectiles.clear();
+    player = nullptr;
+    orc.clear();
+    archers.clear();
+    fallT.clear();
+    objects.clear();
+    doors.clear();
+    crates.clear();
+    plates.clear();
+    arrowTraps.clear();
+    projectiles.clear();
+    potions.clear();
+    broadphase.clear();
+    enemies.clear();
+    // destroys every level object at once and keeps the memory for the next level
+    levelArena.reset();
+    MapObject::releaseLevelTextures();
+    map.unloadTileset();
+}
+
+// Sleep bookkeeping for actors and map objects: count skipped ticks while out of range and
+// catch up in one wake() call on return. Returns true if `e` should update this tick.
+template <class T>
+static bool tickAwake(T& e, bool inRange)
+{
+    if (!inRange) {
+        ++e.sleptTicks;
+        return false;
+    }
+    if (e.sleptTicks > 0) {
+        e.wake(e.sleptTicks);
+        e.sleptTicks = 0;
+    }
+    return true;
+}
+
+// Index the enemies and decide who is awake; once per tick, and again after a level load
+void Engine::gatherEnemies()
+{
+    // everything outside the camera view grown by activationRadius sleeps this tick
+    activeArea = { camera.x - activationRadius, camera.y - activationRadius,
+                   SCREEN_W / VIEW_SCALE + activationRadius * 2.0f,
+                   SCREEN_H / VIEW_SCALE + activationRadius * 2.0f };
+    enemies.gather(orc, archers);
+    EnemySystems::markAwake(enemies, activeArea);
+}
+
+// Re-insert everything that takes part in entity/object interactions this tick
+void Engine::rebuildBroadphase()
+{
+    broadphase.clear();
+    if (player) broadphase.insert(player, SpatialHash::PLAYER);
+    enemies.refresh();
+    for (int i = 0; i < enemies.size(); ++i)
+        broadphase.insert(enemies.actor[i], SpatialHash::Kind(enemies.kind[i]), enemies.body(i), enemies.attack(i));
+    for (auto* mo : objects)
+        broadphase.insert(mo);
+    broadphase.build();
+}
+
+// Resolve trigger links to direct handles once per level; triggers never search at runtime
+void Engine::linkTriggers()
+{
+    for (auto* pp : plates) pp->link(arrowTraps, doors, fallT);
+    for (auto* at : arrowTraps) at->linkPlates(plates);
 }
 
 // --------------------------------------------------
@@ -423,8 +497,8 @@ void Engine::handleEvents()
 void Engine::update()
 {
     if (currentLevelID == 39)
-		sound->playSfx("orc_laugh");
-    playerLastFacing = player->obj.facing;
+		sound->playSfx(Sfx::ORC_LAUGH);
+    playerLastFacing = player->obj->facing;
     // advance autonomous background scrolling (fixed step)
     const float bgDt = 1.0f / 60.0f;
     for (auto* b : backgrounds) if (b) b->update(bgDt);
@@ -461,12 +535,16 @@ void Engine::update()
         if (sound) sound->update();
         return;
     }
+
+    // one enemy index per tick; the dead are only erased at the end of the tick
+    gatherEnemies();
+
 	if (currentLevelID >= 39)
         sound->stopMusic();
     if (!transitioning && player)
     {
-        int tx = int(player->obj.x) / TILE_SIZE;
-        int ty = int(player->obj.y) / TILE_SIZE;
+        int tx = int(player->obj->x) / TILE_SIZE;
+        int ty = int(player->obj->y) / TILE_SIZE;
 
         if (tx >= 0 && ty >= 0 && tx < map.width && ty < map.height)
         {
@@ -492,7 +570,7 @@ void Engine::update()
                         // Ignore held Up until it is released to avoid immediately wrapping back
                         ignoreWrapUp = true;
                         transitionTimer = TRANSITION_DURATION;
-                        if (player) player->obj.canMove = false;
+                        if (player) player->obj->canMove = false;
                     }
                 }
             }
@@ -516,7 +594,7 @@ void Engine::update()
                         // Ignore held Up until it is released to avoid immediately wrapping back
                         ignoreWrapUp = true;
                         transitionTimer = TRANSITION_DURATION;
-                        if (player) player->obj.canMove = false;
+                        if (player) player->obj->canMove = false;
                     }
                 }
             }
@@ -529,20 +607,28 @@ void Engine::update()
                     transitioning = true;
                     transitionTimer = TRANSITION_DURATION;
                     // Prevent player from moving during transition
-                    if (player) player->obj.canMove = false;
+                    if (player) player->obj->canMove = false;
                 }
             }
 
             if (!inGameOver) {
-                // Update all game objects
-                for (auto* r : orc)
-                    r->aiUpdate(*player, map);
-
-                for (auto* a : archers)
-                    a->aiUpdate(*player, map, projectiles);
+                // one shared clock for all animated map tiles
+                map.updateAnimations();
+
+                // Update all game objects: orcs then archers, as laid out in `enemies`
+                for (int i = 0; i < enemies.size(); ++i) {
+                    GameObject* e = enemies.actor[i];
+                    if (!tickAwake(*e, enemies.awake[i] != 0)) continue;
+                    if (enemies.kind[i] == SpatialHash::ORC)
+                        static_cast<Orc*>(e)->aiUpdate(*player, map);
+                    else
+                        static_cast<Archer*>(e)->aiUpdate(*player, map, projectiles);
+                }
 
                 for (auto* f : fallT)
                 {
+                    // idle traps have no state to catch up on
+                    if (!f->isBusy() && !inActiveArea(f->getRect())) continue;
                     f->checkTrigger(*player, map);
                     f->update(map);
                     for (auto* r : orc)
@@ -551,13 +637,28 @@ void Engine::update()
                         f->checkTrigger(*a, map);
                 }
 
+                // Objects always tick against the player; enemies only reach the objects
+                // whose interaction area they are standing in
+                rebuildBroadphase();
+                // plates settle first so traps/doors linked to them react this tick
+                for (auto* pp : plates)
+                    pp->evaluate(broadphase, map);
                 for (auto* o : objects)
                 {
+                    bool awake = o->keepAwake() || inActiveArea(o->getInteractionRect());
+                    if (!tickAwake(*o, awake)) {
+                        // still publish open/close changes made from outside (plates)
+                        o->syncOccupancy(map);
+                        continue;
+                    }
                     o->update(*player, map);
-                    for (auto* r : orc)
-                        o->update(*r, map);
-                    for (auto* a : archers)
-                        o->update(*a, map);
+                    if (o->active) {
+                        broadphase.query(o->getInteractionRect(), SpatialHash::ENEMY, nearby);
+                        for (auto* e : nearby)
+                            o->update(*e->actor, map);
+                    }
+                    // publish moves / open-close changes to Map::isSolid
+                    o->syncOccupancy(map);
                 }
             }
         }
@@ -574,185 +675,12 @@ void Engine::update()
     }
 
     if (!player) return;
-    if (player->obj.alive && !inGameOver) {
-        // Preserve previous X/Y to determine movement direction for collision resolution
-        float prevPlayerX = player->obj.x;
-        float prevPlayerY = player->obj.y;
+    if (player->obj->alive && !inGameOver) {
         player->update(map);
 
-        // Prevent player from walking through orcs: if player's hitbox intersects an orc,
-        // push the player out horizontally to the side of the orc and stop horizontal velocity.
-        for (auto* e : orc) {
-            if (!e || !e->obj.alive) continue;
-
-            SDL_FRect pr = player->getRect();
-            SDL_FRect er = e->getRect();
-
-            if (SDL_HasRectIntersectionFloat(&pr, &er)) {
-                // If player moved right into the orc, snap player to left side
-                if (player->obj.x > prevPlayerX) {
-                    player->obj.x = e->obj.x - player->obj.tileWidth;
-                }
-                // If player moved left into the orc, snap player to right side
-                else if (player->obj.x < prevPlayerX) {
-                    player->obj.x = e->obj.x + e->obj.tileWidth;
-                }
-                else {
-                    // No horizontal movement this frame — nudge based on centers
-                    float pCenter = pr.x + pr.w * 0.5f;
-                    float eCenter = er.x + er.w * 0.5f;
-                    if (pCenter < eCenter)
-                        player->obj.x = e->obj.x - player->obj.tileWidth;
-                    else
-                        player->obj.x = e->obj.x + player->obj.tileWidth;
-                }
-
-                player->obj.velx = 0.0f;
-                // Update prevPlayerX so multiple overlapping orcs resolve correctly in a single frame
-                prevPlayerX = player->obj.x;
-            }
-        }
-        // Also prevent walking through archers using same resolution logic
-        for (auto* a : archers) {
-            if (!a || !a->obj.alive) continue;
-
-            SDL_FRect pr = player->getRect();
-            SDL_FRect ar = a->getRect();
-
-            if (SDL_HasRectIntersectionFloat(&pr, &ar)) {
-                if (player->obj.x > prevPlayerX) {
-                    player->obj.x = a->obj.x - player->obj.tileWidth;
-                }
-                else if (player->obj.x < prevPlayerX) {
-                    player->obj.x = a->obj.x + a->obj.tileWidth;
-                }
-                else {
-                    float pCenter = pr.x + pr.w * 0.5f;
-                    float aCenter = ar.x + ar.w + 0.5f;
-                    if (pCenter < aCenter)
-                        player->obj.x = a->obj.x - player->obj.tileWidth;
-                    else
-                        player->obj.x = a->obj.x + player->obj.tileWidth;
-                }
-
-                player->obj.velx = 0.0f;
-                prevPlayerX = player->obj.x;
-            }
-        }
-
-        // Prevent passing through closed doors: resolve collisions against Door MapObjects
-        for (auto* mo : objects) {
-            if (!mo) continue;
-            // only consider Door instances
-            Door* d = dynamic_cast<Door*>(mo);
-            if (!d || !d->active) continue;
-            if (d->isOpen()) continue; // open doors are passable
-
-            SDL_FRect pr = player->getRect();
-            SDL_FRect dr = d->getRect();
-            if (SDL_HasRectIntersectionFloat(&pr, &dr)) {
-                if (player->obj.x > prevPlayerX) {
-                    // moved right into door
-                    player->obj.x = dr.x - player->obj.tileWidth;
-                } else if (player->obj.x < prevPlayerX) {
-                    // moved left into door
-                    player->obj.x = dr.x + dr.w;
-                } else {
-                    float pCenter = pr.x + pr.w * 0.5f;
-                    float dCenter = dr.x + dr.w * 0.5f;
-                    if (pCenter < dCenter)
-                        player->obj.x = dr.x - player->obj.tileWidth;
-                    else
-                        player->obj.x = dr.x + dr.w;
-                }
-                player->obj.velx = 0.0f;
-                prevPlayerX = player->obj.x;
-            }
-        }
-
-        // Prevent passing through crates and allow pushing them by walking into them
-        // Allow landing on thin pressure plates (2px) so player can stand slightly above ground.
-        for (auto* mo : objects) {
-            if (!mo || !mo->active) continue;
-            PressurePlate* pp = dynamic_cast<PressurePlate*>(mo);
-            if (!pp) continue;
-
-            // hitbox top (anchored 2px above the tile bottom)
-            SDL_FRect pr = player->getRect();
-            SDL_FRect plateRect = pp->getRect();
-            float plateTop = plateRect.y + (plateRect.h - 2.0f); // y position of the 2px trigger
-
-            // quick horizontal overlap check
-            float overlapX = std::min(pr.x + pr.w, plateRect.x + plateRect.w) - std::max(pr.x, plateRect.x);
-            if (overlapX <= 0) continue;
-
-            // require downward crossing of the plate's top to count as landing
-            float prevBottom = prevPlayerY + player->obj.tileHeight;
-            float currBottom = pr.y + pr.h;
-            // Only snap if player was strictly above plate previously and now crosses its top while moving down
-            if (prevBottom < plateTop && currBottom >= plateTop && player->obj.vely >= 0.0f) {
-                player->obj.y = plateTop - player->obj.tileHeight;
-                player->obj.vely = 0.0f;
-                player->obj.onGround = true;
-                prevPlayerX = player->obj.x;
-            }
-        }
-
-        for (auto* mo : objects) {
-            if (!mo || !mo->active) continue;
-            Crate* c = dynamic_cast<Crate*>(mo);
-            if (!c) continue;
-
-            SDL_FRect pr = player->getRect();
-            SDL_FRect cr = c->getRect();
-            if (!SDL_HasRectIntersectionFloat(&pr, &cr)) continue;
-
-            // compute overlap extents
-            float overlapX = std::min(pr.x + pr.w, cr.x + cr.w) - std::max(pr.x, cr.x);
-            float overlapY = std::min(pr.y + pr.h, cr.y + cr.h) - std::max(pr.y, cr.y);
-
-            // Decide whether collision is primarily vertical (landing on crate) or horizontal (walking into crate)
-            bool verticalCollision = false;
-            float prevBottom = prevPlayerY + player->obj.tileHeight;
-            float crateTop = cr.y;
-            // If the player's previous bottom was at or above the crate top (within tolerance), prefer vertical landing
-            if (prevBottom <= crateTop + 6.0f) verticalCollision = true;
-            // Also, if vertical overlap is smaller than horizontal overlap, treat as vertical
-            if (overlapY <= overlapX) verticalCollision = true;
-
-            if (verticalCollision) {
-                // Snap player to top of crate so they can stand even if positions are not tile-aligned
-                player->obj.y = crateTop - player->obj.tileHeight;
-                player->obj.vely = 0.0f;
-                player->obj.onGround = true;
-                // Gently carry player horizontally by crate velocity
-                player->obj.x += c->velx;
-                prevPlayerX = player->obj.x;
-            }
-            else {
-                // horizontal resolution (player walked into crate)
-                if (player->obj.x > prevPlayerX) {
-                    // moved right into crate
-                    player->obj.x = cr.x - player->obj.tileWidth;
-                } else if (player->obj.x < prevPlayerX) {
-                    // moved left into crate
-                    player->obj.x = cr.x + cr.w;
-                } else {
-                    // no horizontal movement this frame — nudge based on centers
-                    float pCenter = pr.x + pr.w * 0.5f;
-                    float cCenter = cr.x + cr.w * 0.5f;
-                    if (pCenter < cCenter) {
-                        player->obj.x = cr.x - player->obj.tileWidth;
-                    } else {
-                        player->obj.x = cr.x + cr.w;
-                    }
-                }
-
-                // stop player's horizontal movement; do NOT modify crate velocity here — only attacks move crates
-                player->obj.velx = 0.0f;
-                prevPlayerX = player->obj.x;
-            }
-        }
+        // Player/enemy/door/crate contacts, resolved against this tick's positions
+        rebuildBroadphase();
+        collisions.resolve(player, enemies, activeArea, broadphase, map);
     }
     else
     {
@@ -760,16 +688,16 @@ void Engine::update()
         if (!inGameOver) {
             inGameOver = true;
             if (sound) {
-                sound->playSfx("death");
+                sound->playSfx(Sfx::DEATH);
                 // Ensure any low-health heartbeat SFX is stopped when entering game over
-                sound->stopSfx("heartbeat");
+                sound->stopSfx(Sfx::HEARTBEAT);
             }
         }
     }
 
     // update projectiles
     // Key pickup detection: if player touches a MapObject with spawn id 10, give key and deactivate it
-    if (player && player->obj.alive && !inGameOver) {
+    if (player && player->obj->alive && !inGameOver) {
         for (auto* mo : objects) {
             if (!mo || !mo->active) continue;
             if (mo->getTileIndex() == 10) {
@@ -780,7 +708,7 @@ void Engine::update()
                     mo->active = false; // remove key from world
                     // persist collection so key won't respawn later
                     markKeyCollected(currentLevelID, mo->getTileX(), mo->getTileY());
-                    if (gSound) gSound->playSfx("arrow", 128, false);
+                    if (gSound) gSound->playSfx(Sfx::ARROW, 128, false);
                     SDL_Log("Picked up key at (%d,%d) on level %d", mo->getTileX(), mo->getTileY(), currentLevelID);
                     break; // only collect one key per frame
                 }
@@ -788,27 +716,29 @@ void Engine::update()
         }
     }
 
-    for (auto it = projectiles.begin(); it != projectiles.end(); ) {
-        Arrow* a = *it;
+    // arrows look up crates/enemies through the broadphase; refresh it since everything moved
+    if (!projectiles.empty()) rebuildBroadphase();
+    for (int i = 0; i < projectiles.size(); ) {
+        Arrow* a = projectiles[i];
         a->update(map);
 
+        // Hit tests below sweep the arrow over this tick's move (see Arrow::sweptHit).
         // Early crate handling: any arrow (archer or trap) should be able to hit/push crates.
         // Do this before player/enemy collisions so arrows interact with world objects first.
         if (a->alive) {
-            SDL_FRect ar = a->getRect();
-            for (auto* mo : objects) {
-                if (!mo || !mo->active) continue;
-                Crate* c = dynamic_cast<Crate*>(mo);
-                if (!c) continue;
+            broadphase.query(a->getSweptRect(), SpatialHash::CRATE, nearby);
+            for (auto* e : nearby) {
+                Crate* c = static_cast<Crate*>(e->object);
+                if (!c->active) continue;
                 SDL_FRect cr = c->getRect();
-                if (SDL_HasRectIntersectionFloat(&ar, &cr) && c->movable && c->hitInvuln == 0) {
+                if (a->sweptHit(cr) && c->movable && c->hitInvuln == 0) {
                     float hNudge = a->isTrapArrow ? 2.0f : 4.0f;
                     float vNudge = a->isTrapArrow ? -1.5f : -3.0f;
                     float dir = (a->getVelX() > 0.0f) ? 1.0f : -1.0f;
                     c->velx = dir * hNudge;
                     if (c->onGround) c->vely = vNudge;
                     c->hitInvuln = 8;
-                    if (gSound) gSound->playSfx("clang", 128, false);
+                    if (gSound) gSound->playSfx(Sfx::CLANG, 128, false);
                     a->alive = false;
                     if (gEngine) gEngine->triggerHitstop(6);
                     break;
@@ -821,12 +751,12 @@ void Engine::update()
             SDL_FRect ar = a->getRect();
 
             // If player is attacking, check attack hitbox against projectile and destroy arrow
-            if (player->obj.attacking) {
+            if (player->obj->attacking) {
                 SDL_FRect atk = player->getAttackRect();
-                if (SDL_HasRectIntersectionFloat(&atk, &ar)) {
+                if (a->sweptHit(atk)) {
                     // Destroy arrow and play feedback
                     a->alive = false;
-                    if (gSound) gSound->playSfx("arrow_impact");
+                    if (gSound) gSound->playSfx(Sfx::ARROW_IMPACT);
                     // trigger small hitstop for arrow parry
                     if (gEngine) gEngine->triggerHitstop(4);
                 }
@@ -835,7 +765,7 @@ void Engine::update()
             // If arrow still alive, check collision with player body
             if (a->alive) {
                 SDL_FRect pr = player->getRect();
-                if (SDL_HasRectIntersectionFloat(&ar, &pr)) {
+                if (a->sweptHit(pr)) {
                     player->takeDamage(15.0f, ar.x + ar.w*0.5f, 3, 6, 30, 2.5f, -4.0f);
                     a->alive = false;
                     // small hitstop when player is hit by arrow
@@ -849,14 +779,17 @@ void Engine::update()
             SDL_FRect ar = a->getRect();
             float attackerX = ar.x + ar.w * 0.5f;
 
-            // Check orcs
-            for (auto* o : orc) {
-                if (!o || !o->obj.alive) continue;
+            // Check orcs, then archers, among the enemies near the arrow
+            broadphase.query(a->getSweptRect(), SpatialHash::ENEMY, nearby);
+            for (auto* e : nearby) {
+                if (e->kind != SpatialHash::ORC) continue;
+                Orc* o = static_cast<Orc*>(e->actor);
+                if (!o->obj->alive) continue;
                 SDL_FRect orcR = o->getRect();
-                if (SDL_HasRectIntersectionFloat(&ar, &orcR)) {
+                if (a->sweptHit(orcR)) {
                     o->takeDamage(15.0f, attackerX, 3, 6, 30, 2.5f, -4.0f);
                     a->alive = false;
-                    if (gSound) gSound->playSfx("arrow_impact");
+                    if (gSound) gSound->playSfx(Sfx::ARROW_IMPACT);
                     if (gEngine) gEngine->triggerHitstop(6);
                     break;
                 }
@@ -864,13 +797,15 @@ void Engine::update()
 
             // Check archers (if arrow still alive)
             if (a->alive) {
-                for (auto* archer : archers) {
-                    if (!archer || !archer->obj.alive) continue;
+                for (auto* e : nearby) {
+                    if (e->kind != SpatialHash::ARCHER) continue;
+                    Archer* archer = static_cast<Archer*>(e->actor);
+                    if (!archer->obj->alive) continue;
                     SDL_FRect arR = archer->getRect();
-                    if (SDL_HasRectIntersectionFloat(&ar, &arR)) {
+                    if (a->sweptHit(arR)) {
                         archer->takeDamage(15.0f, attackerX, 3, 6, 30, 2.5f, -4.0f);
                         a->alive = false;
-                        if (gSound) gSound->playSfx("arrow_impact");
+                        if (gSound) gSound->playSfx(Sfx::ARROW_IMPACT);
                         if (gEngine) gEngine->triggerHitstop(6);
                         break;
                     }
@@ -879,20 +814,19 @@ void Engine::update()
 
             // For any arrow (archer or trap), also allow it to hit/push crates
             if (a->alive) {
-                SDL_FRect ar = a->getRect();
-                for (auto* mo : objects) {
-                    if (!mo || !mo->active) continue;
-                    Crate* c = dynamic_cast<Crate*>(mo);
-                    if (!c) continue;
+                broadphase.query(a->getSweptRect(), SpatialHash::CRATE, nearby);
+                for (auto* e : nearby) {
+                    Crate* c = static_cast<Crate*>(e->object);
+                    if (!c->active) continue;
                     SDL_FRect cr = c->getRect();
-                    if (SDL_HasRectIntersectionFloat(&ar, &cr) && c->movable && c->hitInvuln == 0) {
+                    if (a->sweptHit(cr) && c->movable && c->hitInvuln == 0) {
                         float hNudge = a->isTrapArrow ? 2.0f : 4.0f;
                         float vNudge = a->isTrapArrow ? -1.5f : -3.0f;
                         float dir = (a->getVelX() > 0.0f) ? 1.0f : -1.0f;
                         c->velx = dir * hNudge;
                         if (c->onGround) c->vely = vNudge;
                         c->hitInvuln = 8;
-                        if (gSound) gSound->playSfx("clang", 128, false);
+                        if (gSound) gSound->playSfx(Sfx::CLANG, 128, false);
                         a->alive = false;
                         if (gEngine) gEngine->triggerHitstop(6);
                         break;
@@ -903,35 +837,34 @@ void Engine::update()
             // (trap-only block ends) - crate handling moved below for all arrows
         }
 
-        if (!a->alive) { delete a; it = projectiles.erase(it); }
-        else ++it;
+        // swap-remove: the last arrow moves into slot i and is processed next
+        if (!a->alive) projectiles.releaseAt(i);
+        else ++i;
     }
 
     // Update potions and handle pickups / removal
-    for (auto itp = potions.begin(); itp != potions.end(); ) {
-        Potion* p = *itp;
-        if (!p) { itp = potions.erase(itp); continue; }
+    for (int i = 0; i < potions.size(); ) {
+        Potion* p = potions[i];
         p->update(map);
-        if (!p->obj.alive) { delete p; itp = potions.erase(itp); }
-        else ++itp;
+        if (!p->obj->alive) potions.releaseAt(i);
+        else ++i;
     }
 
     // spawn potions from dead enemies (10% chance)
     for (auto it = orc.begin(); it != orc.end(); ) {
         Orc* e = *it;
-        if (!e || !e->obj.alive) {
+        if (!e || !e->obj->alive) {
             // determine spawn chance
-            int r = rand() % 100;
+            int r = gRng.loot.range(0, 99);
 			if (r < 20) { // 20% chance to spawn potion
                 // choose potion type randomly with 7:3 health:mana ratio
-                int t = (rand() % 10) < 7 ? 0 : 1; // 0 = health (70%), 1 = mana (30%)
-                float spawnX = e ? e->obj.x : 0.0f;
-                float spawnY = (e ? e->obj.y : 0.0f) - 32.0f; // spawn 32px above ground
-                std::string path = (t == 0) ? "Assets/Sprites/healthPot.png" : "Assets/Sprites/manaPot.png";
-                Potion* p = new Potion(renderer, path, 16, 16, spawnX, spawnY, t == 0 ? Potion::Type::HEALTH : Potion::Type::MANA);
-                potions.push_back(p);
+                int t = gRng.loot.range(0, 9) < 7 ? 0 : 1; // 0 = health (70%), 1 = mana (30%)
+                float spawnX = e ? e->obj->x : 0.0f;
+                float spawnY = (e ? e->obj->y : 0.0f) - 32.0f; // spawn 32px above ground
+                if (!potions.acquire(renderer, spawnX, spawnY, t == 0 ? Potion::Type::HEALTH : Potion::Type::MANA))
+                    SDL_Log("Potion pool full (%d), drop skipped", potions.capacity());
             }
-            delete e;
+            // the arena destroys it with the rest of the level
             it = orc.erase(it);
         } else ++it;
     }
@@ -953,9 +886,9 @@ void Engine::update()
                     currentLevelID = 22;
                 }
                 loadLevel(currentLevelID);
-                if (player) player->obj.health = player->obj.maxHealth;
-                if (player) player->obj.magic = player->obj.maxMagic;
-                if (sound) sound->stopSfx("heartbeat");
+                if (player) player->stats.health = player->stats.maxHealth;
+                if (player) player->stats.magic = player->stats.maxMagic;
+                if (sound) sound->stopSfx(Sfx::HEARTBEAT);
                 inMenu = true;
             } else if (sel == 1) {
                 // Quit
@@ -964,10 +897,10 @@ void Engine::update()
         }
     }
 
-    if (player->obj.health <= 39 && sound && !inGameOver)
-        sound->playSfx("heartbeat");
+    if (player->stats.health <= 39 && sound && !inGameOver)
+        sound->playSfx(Sfx::HEARTBEAT);
 
-    camera.update(player->obj.x, player->obj.y,
+    camera.update(player->obj->x, player->obj->y,
         map.width, SCREEN_W,
         map.height, SCREEN_H,
         TILE_SIZE, VIEW_SCALE);
@@ -979,7 +912,7 @@ void Engine::update()
     if (infoText && player) {
         // single call: InfoText will choose which message/icon to show based on level and input device
         // Do not override the last-input state here — it is managed in handleEvents when input is detected.
-        infoText->updateAuto(currentLevelID, player->obj.x + player->obj.tileWidth * 0.5f, &map);
+        infoText->updateAuto(currentLevelID, player->obj->x + player->obj->tileWidth * 0.5f, &map);
     }
 }
 
@@ -1030,7 +963,7 @@ void Engine::render()
         map.drawForeground(renderer, camera.x, camera.y);
 
         // Draw HUD including magic
-        if (hud && player) hud->draw(renderer, player->obj.health, player->obj.maxHealth, player->obj.magic, player->obj.maxMagic, player->hasKey);
+        if (hud && player) hud->draw(renderer, player->stats.health, player->stats.maxHealth, player->stats.magic, player->stats.maxMagic, player->hasKey);
 
         gameOver->render(renderer);
         SDL_RenderPresent(renderer);
@@ -1038,6 +971,9 @@ void Engine::render()
     }
 
     //SDL_SetRenderDrawColor(renderer, 31, 14, 28, 255);
+    // sky colour shows wherever the background layers leave gaps; set it every frame since
+    // UI layers and background compositing leave their own clear colour behind
+    SDL_SetRenderDrawColor(renderer, 169, 228, 238, 255);
     SDL_RenderClear(renderer);
 
     // draw background for current level if any
@@ -1050,7 +986,10 @@ void Engine::render()
     
     map.drawForeground(renderer, camera.x, camera.y);
 
-    // Draw objects that should appear behind the player (e.g., waterfall backdrops)
+    // Animated tiles that sit behind entities (waterfall backdrops)
+    map.drawAnimatedTiles(renderer, camera.x, camera.y, true);
+
+    // Draw objects that should appear behind the player
     for (auto* mo : objects) {
         if (!mo) continue;
         if (mo->drawBehind) mo->draw(renderer, camera.x, camera.y, map);
@@ -1081,7 +1020,8 @@ void Engine::render()
 
     // draw base map layer on top of sprites if necessary (preserve previous behavior)
     map.draw(renderer, camera.x, camera.y);
-    
+    // Animated tiles in front of the tile layer (water surfaces)
+    map.drawAnimatedTiles(renderer, camera.x, camera.y, false);
 
     // Draw tall/overlay objects after map so they appear on top of player/tiles
     for (auto* mo : objects) {
@@ -1092,7 +1032,7 @@ void Engine::render()
     }
 
     // Draw HUD last so it's on top (include key indicator)
-    if (hud && player) hud->draw(renderer, player->obj.health, player->obj.maxHealth, player->obj.magic, player->obj.maxMagic, player->hasKey);
+    if (hud && player) hud->draw(renderer, player->stats.health, player->stats.maxHealth, player->stats.magic, player->stats.maxMagic, player->hasKey);
 
     // Draw in-world info text (after world rendering but before HUD maybe)
     if (infoText) infoText->draw(renderer, camera);
@@ -1120,10 +1060,10 @@ void Engine::loadLevel(int levelID)
     // Preserve whether player had a key
     bool savedHasKey = false;
     if (player) {
-        savedHealth = player->obj.health;
-        savedMaxHealth = player->obj.maxHealth;
-        savedMagic = player->obj.magic;
-        savedMaxMagic = player->obj.maxMagic;
+        savedHealth = player->stats.health;
+        savedMaxHealth = player->stats.maxHealth;
+        savedMagic = player->stats.magic;
+        savedMaxMagic = player->stats.maxMagic;
         savedHasKey = player->hasKey;
     }
 
@@ -1131,6 +1071,8 @@ void Engine::loadLevel(int levelID)
     // Cleanup previous level
     // ----------------------------------------
     cleanupObjects();
+    // everything the old level owned is gone now; report what it left behind
+    ResourceTracker::levelReport(levelID);
 
     char name[8];
     snprintf(name, sizeof(name), "%03d", levelID);
@@ -1146,6 +1088,18 @@ void Engine::loadLevel(int levelID)
     // attempt to load optional foreground layer (Tile Layer 2)
     map.loadLayer2CSV("Maps/" + std::string(name) + "_Tile Layer 2.csv");
 
+    // decorative animated tiles (water, waterfalls) come straight from the spawn layer
+    map.loadAnimatedTiles(renderer);
+    map.collectAnimatedTiles();
+
+    // broadphase grid covers the whole level
+    broadphase.reset(map.width * Map::TILE_SIZE, map.height * Map::TILE_SIZE);
+    // solid objects stamp their tiles into the occupancy layer once spawned
+    map.resetOccupancy();
+
+    // hint text triggers are fixed per level
+    if (infoText) infoText->resolveTriggers(&map);
+
     // ----------------------------------------
     // Determine PLAYER spawn position
     // ----------------------------------------
@@ -1217,21 +1171,21 @@ void Engine::loadLevel(int levelID)
     // Create PLAYER (ENGINE-OWNED)
     // ----------------------------------------
     const char* spritePath =
-        (rand() % 2 == 0)
+        (gRng.level.range(0, 1) == 0)
         ? "Assets/Sprites/player.png"
         : "Assets/Sprites/swordsman.png";
     
-    player = new Player(renderer, "Assets/Sprites/swordsman.png", 12, 16);
-    player->obj.x = spawnX;
-    player->obj.y = spawnY;
-    player->obj.canMove = true;
+    player = levelArena.make<Player>(renderer, "Assets/Sprites/swordsman.png", 12, 16);
+    player->obj->x = spawnX;
+    player->obj->y = spawnY;
+    player->obj->canMove = true;
 
     // Restore persisted health if available
-    player->obj.health = savedHealth;
-    player->obj.maxHealth = savedMaxHealth;
+    player->stats.health = savedHealth;
+    player->stats.maxHealth = savedMaxHealth;
     // Restore persisted magic if available
-    player->obj.magic = savedMagic;
-    player->obj.maxMagic = savedMaxMagic;
+    player->stats.magic = savedMagic;
+    player->stats.maxMagic = savedMaxMagic;
     // Restore whether player had key
     player->hasKey = savedHasKey;
 
@@ -1240,277 +1194,10 @@ void Engine::loadLevel(int levelID)
     // ----------------------------------------
     // Spawn MAP OBJECTS (NOT PLAYER)
     // ----------------------------------------
-    int orcNum = -1;
-    auto spawns = map.getObjectSpawns();
-
-    // track which spawn tiles we've consumed when forming multi-tile platforms
-    std::vector<char> processed(map.width * map.height, 0);
-    for (const auto& s : spawns)
-    {
-        int sx = s.x;
-        int sy = s.y;
-        int idx = sy * map.width + sx;
-        if (processed[idx]) continue;
-
-        int t = s.tileIndex;
-
-        // Multi-tile platform starting with left edge (363)
-        if (t == 363) {
-            std::vector<int> tiles;
-            int curx = sx;
-            // collect left (363), zero or more middle (364), optional right (365)
-            for (;; ++curx) {
-                if (curx >= map.width) break;
-                int st = map.spawn[sy * map.width + curx];
-                if (curx == sx) {
-                    if (st != 363) break; // sanity
-                    tiles.push_back(st);
-                    processed[sy * map.width + curx] = 1;
-                    continue;
-                }
-                if (st == 364) {
-                    tiles.push_back(st);
-                    processed[sy * map.width + curx] = 1;
-                    continue;
-                }
-                if (st == 365) {
-                    tiles.push_back(st);
-                    processed[sy * map.width + curx] = 1;
-                    break;
-                }
-                // stop if encounter anything else
-                break;
-            }
-            // create platform from collected tiles
-            if (!tiles.empty()) {
-                objects.push_back(new FallingPlatform(sx, sy, tiles));
-            }
-            continue;
-        }
-
-        // Single-tile platform (366)
-        if (t == 366) {
-            processed[idx] = 1;
-            objects.push_back(new FallingPlatform(sx, sy, std::vector<int>{366}));
-            continue;
-        }
-
-        // Non-platform spawns
-        processed[idx] = 1;
-        float px = float(sx * Map::TILE_SIZE);
-        float py = float(sy * Map::TILE_SIZE);
-
-        switch (t)
-        {
-        case Map::SPAWN_PLAYER:
-            // 🚫 Player already handled
-            break;
-
-        case Map::SPAWN_ORC:
-            orc.push_back(new Orc(renderer,"Assets/Sprites/orc.png",12, 16,px, py , 20));
-            orcNum++;
-            break;
-        case Map::SPAWN_CHECKPOINT:
-        {
-            Checkpoint* cp = new Checkpoint(sx, sy, s.tileIndex);
-            cp->setLevel(levelID);
-            // Only move the player's spawn to the checkpoint position if we're currently respawning from a checkpoint
-            // (i.e., the player died and selected Restart). This prevents normal portal transitions from using checkpoints.
-            if (respawnFromCheckpoint && levelID == lastCheckpointLevel) {
-                player->obj.x = float(sx * Map::TILE_SIZE);
-                player->obj.y = float(sy * Map::TILE_SIZE);
-            }
-            objects.push_back(cp);
-        }
-        break;
-
-        case Map::SPAWN_WATERFALL_LONG:
-        {
-            // Narrow tall waterfall (16x32, 4 frames) that sits behind the player
-            MapObject* mo = new MapObject(sx, sy, s.tileIndex);
-            mo->setSize(16, 32);
-            if (!mo->loadAnimation(renderer, "Assets/Sprites/waterfall_long.png", 16, 32, 4, 0, 0, 0, 16, 32, 12)) {
-                SDL_Log("Failed to load waterfall_long animation");
-            }
-            // move up by 16px so bottom aligns with tile
-            mo->offsetPosition(0, -16);
-            mo->drawBehind = true;
-            objects.push_back(mo);
-        }
-        break;
-        case Map::SPAWN_DUNGEON_WATER:
-        {
-            // Dungeon water sprite that should appear in front of the player
-            MapObject* mo = new MapObject(sx, sy, s.tileIndex);
-            mo->setSize(16, 48);
-            if (!mo->loadAnimation(renderer, "Assets/Sprites/dungeon_water.png", 16, 48, 4, 0, 0, 0, 16, 48, 12)) {
-                SDL_Log("Failed to load dungeon_water animation");
-            }
-            // Move up 32px so bottom aligns with tile
-            mo->offsetPosition(0, -32);
-            // default drawBehind is false, so this will render in front of the player
-            objects.push_back(mo);
-        }
-        break;
-        case Map::SPAWN_WATER:
-        {
-            // Create a generic MapObject and load a water animation for it
-            MapObject* mo = new MapObject(sx, sy, s.tileIndex);
-            mo->setSize(16, 32);
-            if (!mo->loadAnimation(renderer, "Assets/Sprites/water.png", 16, 32, 4, 0, 0, 0, 16, 32, 12)) {
-                SDL_Log("Failed to load water animation");
-            }
-            // Sprite is taller (32) than tile (16). Move object up one tile so bottoms align.
-            mo->offsetPosition(0, -Map::TILE_SIZE);
-            objects.push_back(mo);
-        }
-        break;
-        case Map::SPAWN_WATERFALL_DAY:
-        {
-            // Create a generic MapObject and load a water animation for it
-            MapObject* mo = new MapObject(sx, sy, s.tileIndex);
-            mo->setSize(48, 64);
-            if (!mo->loadAnimation(renderer, "Assets/Sprites/waterfall_day.png", 48, 64, 5, 0, 0, 0, 48, 64, 12)) {
-                SDL_Log("Failed to load waterfall animation");
-            }
-            //mo->offsetPosition(-48-16, -64-16);
-            objects.push_back(mo);
-        }
-        break;
-
-        case Map::SPAWN_WATERFALL:
-        {
-            // Create a generic MapObject and load a narrow waterfall animation (16x48, 4 frames)
-            MapObject* mo = new MapObject(sx, sy, s.tileIndex);
-            mo->setSize(16, 48);
-            if (!mo->loadAnimation(renderer, "Assets/Sprites/waterfall.png", 16, 48, 4, 0, 0, 0, 16, 48, 12)) {
-                SDL_Log("Failed to load waterfall animation");
-            }
-            // Sprite is taller (48) than tile (16). Move object up so bottoms align (48 - 16 = 32 px)
-            mo->offsetPosition(0, -32);
-            // Draw this waterfall behind the player
-            mo->drawBehind = true;
-            objects.push_back(mo);
-        }
-        break;
-
-        case Map::SPAWN_SLIME:
-            orc.push_back(new Orc(renderer,"Assets/Sprites/slime.png",12, 16,px, py , 10));
-            orcNum++;
-			orc[orcNum]->chaseSpeed = 0.4f;
-            orc[orcNum]->frames.walk = 6;
-            orc[orcNum]->frames.attack = 6;
-            orc[orcNum]->animFlash = new AnimationManager(orc[orcNum]->tex, 100, 100, 4 , 400, 44, 42, orc[orcNum]->obj.tileWidth, orc[orcNum]->obj.tileHeight);
-            break;
-
-        case Map::SPAWN_SKELETON:
-            orc.push_back(new Orc(
-                renderer,
-                "Assets/Sprites/Skeleton.png",
-                12, 16,
-                px, py, 20, true
-            ));
-            orcNum++;
-            orc[orcNum]->chaseSpeed = 0.7f;
-            break;
-
-        case Map::SPAWN_FALLINGTRAP:
-            fallT.push_back(new FallingTrap(renderer, s.x, s.y));
-            break;
-
-        case Map::SPAWN_SPIKES:
-            objects.push_back(new Spikes(s.x, s.y, s.tileIndex));
-            break;
-
-        case Map::SPAWN_PRESSURE_PLATE:
-        {
-            PressurePlate* pp = new PressurePlate(sx, sy, s.tileIndex);
-            // Configure per-level plate behavior. Use levelID to decide what this plate should do.
-            // Example mapping: add cases here to customize behavior per level and per-plate coords.
-            switch (levelID) {
-            case 43:
-                // In level 22, all pressure plates fire nearby arrow traps
-                pp->setTargetAction(PressurePlate::TargetAction::FIRE_ARROWTRAPS);
-                break;
-            case 22:
-                // In level 22, all pressure plates fire nearby arrow traps
-                pp->setTargetAction(PressurePlate::TargetAction::FIRE_ARROWTRAPS);
-                break;
-            case 222:
-                // In level 24, a specific plate opens a door at (tx,ty)
-                if (sx == 12 && sy == 4) {
-                    pp->setTargetAction(PressurePlate::TargetAction::OPEN_DOOR, 13, 4);
-                }
-                break;
-            case 228:
-                // In level 28, a plate drops a falling trap at specific coords
-                if (sx == 9 && sy == 7) {
-                    pp->setTargetAction(PressurePlate::TargetAction::DROP_FALLINGTRAP, 10, 7);
-                }
-                break;
-            default:
-                // leave as NONE by default
-                break;
-            }
-
-            // Pressure plate sprite should be positioned at tile top; no vertical offset necessary
-            objects.push_back(pp);
-        }
-        break;
-
-        case Map::SPAWN_ARCHER:
-            archers.push_back(new Archer(renderer, "Assets/Sprites/archer.png", 12, 16, px, py, 10));
-            break;
-        case Map::SPAWN_ARROWTRAP_LEFT:
-        {
-            ArrowTrap* at = new ArrowTrap(renderer, s.x, s.y, s.tileIndex);
-            if (levelID == 44) at->setAutoFire(true);
-            objects.push_back(at);
-        }
-            break;
-        case Map::SPAWN_ARROWTRAP_RIGHT:
-        {
-            ArrowTrap* at = new ArrowTrap(renderer, s.x, s.y, s.tileIndex);
-            if (levelID == 44) at->setAutoFire(true);
-            objects.push_back(at);
-        }
-            break;
-        case Map::SPAWN_DOOR:
-        {
-            Door* d = new Door(sx, sy, s.tileIndex);
-            // load door animation: assume sprite "Assets/Sprites/door.png" with frames horizontally
-            if (!d->loadAnimation(renderer, "Assets/Sprites/door.png", 32, 48, 8, 0, 0, 0, 32, 48, 8)) {
-                SDL_Log("Failed to load door animation");
-            }
-            // set level for persistence and restore opened state if previously opened
-            d->setLevel(levelID);
-            if (isDoorOpened(levelID, sx, sy)) {
-                d->open(false); // open silently without SFX when restoring state
-            }
-            objects.push_back(d);
-        }
-        break;
-       case Map::SPAWN_KEY: // key spawn
-        {
-            // Only spawn key object if it hasn't already been collected
-            if (!isKeyCollected(levelID, sx, sy)) {
-                MapObject* mo = new MapObject(sx, sy, s.tileIndex);
-                // use default tile rendering (no animation) so tile from tileset is shown
-                objects.push_back(mo);
-            }
-        }
-        break;
-        case Map::SPAWN_CRATE:
-        {
-            Crate* c = new Crate(sx, sy, s.tileIndex);
-            objects.push_back(c);
-        }
-        break;
-        default:
-            // unhandled spawn types are ignored
-            break;
-        }
-    }
+    // one registry lookup per spawn tile; see SpawnRegistry.cpp for the factories
+    SpawnRegistry::spawnAll(*this, levelID);
+    for (auto* mo : objects) mo->syncOccupancy(map);
+    linkTriggers();
 
     // ----------------------------------------
     // Finalize level state
@@ -1525,6 +1212,9 @@ void Engine::loadLevel(int levelID)
         lastStartPosX = spawnX;
         lastStartPosY = spawnY;
     }
+
+    // the rest of this tick runs against the new level's enemies
+    gatherEnemies();
 }
 
 
@@ -1533,11 +1223,11 @@ void Engine::setPlayerFacingFromEntry(int entryTile)
     switch (entryTile)
     {
     case LEFT: // came from LEFT
-        player->obj.facing = false;
+        player->obj->facing = false;
         break;
 
     case RIGHT: // came from RIGHT
-        player->obj.facing = true;
+        player->obj->facing = true;
         break;
 
     case UP: // came from UP
@@ -1564,8 +1254,13 @@ void Engine::triggerHitstop(int ticks)
 
 int main(int argc, char* argv[])
 {
-    // Call once at program start
-    srand(static_cast<unsigned>(time(nullptr)));
+    // Seed every gameplay random stream once at program start. Pass --seed N to replay a session.
+    Uint64 seed = Uint64(time(nullptr));
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--seed") == 0) seed = std::strtoull(argv[i + 1], nullptr, 10);
+    }
+    gRng.seed(seed);
+    SDL_Log("Main: session seed %llu", (unsigned long long)seed);
 
     Engine engine;
 
@@ -13,11 +13,22 @@
 #include "GameOver.h"
 #include "Background.h"
 #include "InfoText.h"
+#include "SpatialHash.h"
+#include "CollisionManager.h"
+#include "EnemyState.h"
+#include "ObjectPool.h"
+#include "LevelArena.h"
+#include "EntityPrototypes.h"
+#include "Arrow.h"
+#include "Potion.h"
 #include <unordered_set>
 
 class Menu;
 class Archer;
 class Arrow;
+class Door;
+class Crate;
+class ArrowTrap;
 class Potion; // forward
 
 #define LEFT  26
@@ -55,6 +66,9 @@ public:
 
 private:
     void cleanupObjects();
+    void rebuildBroadphase();
+    void gatherEnemies();
+    void linkTriggers();
 
     const uint32_t SCREEN_W = 320;
     const uint32_t SCREEN_H = 240;
@@ -68,13 +82,37 @@ public:
 
     Map map;
     Camera camera;
+    // Owns the player, enemies, map objects and falling traps of the current level;
+    // the vectors below only point into it. Reset by cleanupObjects().
+    LevelArena levelArena;
+    // Enemy variants configured once; loadLevel clones these
+    EntityPrototypes prototypes;
     Player* player = nullptr;
     std::vector<Orc*> orc;
     std::vector<Archer*> archers;
     std::vector<MapObject*> objects;
+    // Typed, non-owning views of `objects` filled by loadLevel, so hot loops
+    // walk only the type they need instead of casting every object
+    std::vector<Door*> doors;
+    std::vector<Crate*> crates;
+    std::vector<PressurePlate*> plates;
+    std::vector<ArrowTrap*> arrowTraps;
     std::vector<FallingTrap*> fallT;
-    std::vector<Arrow*> projectiles;
-    std::vector<Potion*> potions; // managed potions
+    // Pooled, so volleys and drops never hit the allocator; iteration order is not stable
+    ObjectPool<Arrow> projectiles{ 256 };
+    ObjectPool<Potion> potions{ 32 };
+    // Broadphase for actor/object interactions; rebuilt during update()
+    SpatialHash broadphase;
+    std::vector<SpatialHash::Entry*> nearby; // scratch list for broadphase queries
+    CollisionManager collisions;
+    // Orcs + archers indexed into the hot store, gathered once per tick by gatherEnemies();
+    // rebuildBroadphase() only refreshes the awake entries' attack boxes
+    EnemyState enemies;
+    // Activation: orcs, archers, falling traps and map objects farther than this (world px)
+    // from the camera view sleep, skipping AI, physics and animation until back in range
+    float activationRadius = 256.0f;
+    SDL_FRect activeArea{ 0, 0, 0, 0 }; // camera view grown by activationRadius, set each tick
+    bool inActiveArea(const SDL_FRect& r) const { return SDL_HasRectIntersectionFloat(&r, &activeArea); }
     Hud* hud = nullptr;
     Sound* sound = nullptr;
     Menu* menu = nullptr;
@@ -0,0 +1,52 @@
+#include "EntityPrototypes.h"
+#include "Orc.h"
+#include "Archer.h"
+#include "LevelArena.h"
+#include "Map.h"
+
+void EntityPrototypes::build(SDL_Renderer* renderer)
+{
+    release();
+
+    orc = new Orc(renderer, "Assets/Sprites/orc.png", 12, 16, 0.0f, 0.0f, 20);
+
+    // walk/attack frame counts and the flash row come from slime.png's clip layout
+    slime = new Orc(renderer, "Assets/Sprites/slime.png", 12, 16, 0.0f, 0.0f, 10);
+    slime->chaseSpeed = 0.4f;
+
+    skeleton = new Orc(renderer, "Assets/Sprites/Skeleton.png", 12, 16, 0.0f, 0.0f, 20, true);
+    skeleton->chaseSpeed = 0.7f;
+
+    archer = new Archer(renderer, "Assets/Sprites/archer.png", 12, 16, 0.0f, 0.0f, 10);
+}
+
+void EntityPrototypes::release()
+{
+    delete orc; orc = nullptr;
+    delete slime; slime = nullptr;
+    delete skeleton; skeleton = nullptr;
+    delete archer; archer = nullptr;
+}
+
+Orc* EntityPrototypes::spawnOrc(LevelArena& arena, int spawnTile, float x, float y) const
+{
+    const Orc* proto = nullptr;
+    switch (spawnTile) {
+    case Map::SPAWN_ORC: proto = orc; break;
+    case Map::SPAWN_SLIME: proto = slime; break;
+    case Map::SPAWN_SKELETON: proto = skeleton; break;
+    default: return nullptr;
+    }
+    if (!proto) return nullptr;
+    Orc* o = arena.make<Orc>(*proto);
+    o->spawnAt(x, y);
+    return o;
+}
+
+Archer* EntityPrototypes::spawnArcher(LevelArena& arena, float x, float y) const
+{
+    if (!archer) return nullptr;
+    Archer* a = arena.make<Archer>(*archer);
+    a->spawnAt(x, y);
+    return a;
+}
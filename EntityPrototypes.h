@@ -0,0 +1,26 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+class Orc;
+class Archer;
+class LevelArena;
+
+// Enemy variants, each built and configured once at startup. loadLevel clones them per
+// spawn, so every instance of a variant shares its sprite sheet clips and settings; only
+// the position and per-instance AI rolls differ.
+class EntityPrototypes {
+public:
+    void build(SDL_Renderer* renderer);
+    void release();
+
+    // Clone the orc-type variant for a spawn tile (orc, slime, skeleton) into `arena`;
+    // nullptr for any other tile
+    Orc* spawnOrc(LevelArena& arena, int spawnTile, float x, float y) const;
+    Archer* spawnArcher(LevelArena& arena, float x, float y) const;
+
+private:
+    Orc* orc = nullptr;
+    Orc* slime = nullptr;
+    Orc* skeleton = nullptr;
+    Archer* archer = nullptr;
+};
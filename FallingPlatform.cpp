@@ -7,24 +7,21 @@
 FallingPlatform::FallingPlatform(int leftTileX, int tileY, const std::vector<int>& tileInds)
     : MapObject(leftTileX, tileY, tileInds.empty() ? -1 : tileInds[0]), initTx(leftTileX), initTy(tileY), initTileIndex(tileInds.empty() ? -1 : tileInds[0]), tileIndices(tileInds), tileCount((int)tileInds.size())
 {
+    tracked.setOwner("FallingPlatform");
     // set width to cover multiple tiles
     w = Map::TILE_SIZE * tileCount;
 }
 
 FallingPlatform::~FallingPlatform() = default;
 
-void FallingPlatform::ensureCollisionLayer(Map& map) {
-    if (map.collision.empty()) {
-        map.collision.assign(map.width * map.height, -1);
-    }
-}
-
 void FallingPlatform::setCollision(Map& map, int val) {
+    // Map creates the collision layer on first write and keeps its packed bits in sync;
+    // this runs every tick, so skip tiles that already hold the value
     for (int i = 0; i < tileCount; ++i) {
         int txi = initTx + i;
         if (txi >= 0 && initTy >= 0 && txi < map.width && initTy < map.height) {
-            ensureCollisionLayer(map);
-            map.collision[initTy * map.width + txi] = val;
+            if (!map.collision.empty() && map.collision[initTy * map.width + txi] == val) continue;
+            map.setCollisionAt(txi, initTy, val);
         }
     }
 }
@@ -76,7 +73,7 @@ void FallingPlatform::update(GameObject& playerObj, Map& map) {
                 // restore spawn tiles and reset platform back to initial position
                 if (initTx >= 0 && initTy >= 0 && initTx < map.width && initTy < map.height && !map.spawn.empty()) {
                     for (int i = 0; i < tileCount; ++i) {
-                        map.spawn[initTy * map.width + (initTx + i)] = tileIndices[i];
+                        map.setSpawnAt(initTx + i, initTy, tileIndices[i]);
                     }
                 }
                 // restore collision and reset object state
@@ -104,11 +101,11 @@ void FallingPlatform::update(GameObject& playerObj, Map& map) {
 
         bool horizOverlap = (pr.x + pr.w > platLeft + 1.0f) && (pr.x < platRight - 1.0f);
         bool feetNearTop = (feetY >= y - 4.0f) && (feetY <= y + 4.0f);
-        if (horizOverlap && feetNearTop && playerObj.obj.vely >= 0.0f) {
+        if (horizOverlap && feetNearTop && playerObj.obj->vely >= 0.0f) {
             // Snap player onto platform
-            playerObj.obj.y = y - playerObj.obj.tileHeight;
-            playerObj.obj.vely = 0.0f;
-            playerObj.obj.onGround = true;
+            playerObj.obj->y = y - playerObj.obj->tileHeight;
+            playerObj.obj->vely = 0.0f;
+            playerObj.obj->onGround = true;
         }
     }
 
@@ -126,9 +123,9 @@ void FallingPlatform::update(GameObject& playerObj, Map& map) {
     bool feetTouching = SDL_HasRectIntersectionFloat(&feetRect, &platformTopRect);
     bool centerOver = (pr.x + pr.w * 0.5f) >= x && (pr.x + pr.w * 0.5f) <= x + w;
 
-    if (feetTouching && centerOver && playerObj.obj.vely >= 0.0f) {
+    if (feetTouching && centerOver && playerObj.obj->vely >= 0.0f) {
         if (!triggered) {
-			gSound->playSfx("fall_plat");
+			gSound->playSfx(Sfx::FALL_PLAT);
             triggered = true;
             delayTimer = delayTicks;
         }
@@ -141,7 +138,7 @@ void FallingPlatform::update(GameObject& playerObj, Map& map) {
             // remove spawn tiles so Map::getCollision no longer treats it as solid
             if (initTx >= 0 && initTy >= 0 && initTx < map.width && initTy < map.height && !map.spawn.empty()) {
                 for (int i = 0; i < tileCount; ++i) {
-                    map.spawn[initTy * map.width + (initTx + i)] = -1;
+                    map.setSpawnAt(initTx + i, initTy, -1);
                 }
             }
             // clear collision entries as it begins to fall
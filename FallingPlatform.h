@@ -10,6 +10,10 @@ public:
 
     void update(GameObject& obj, Map& map) override;
     void draw(SDL_Renderer* renderer, int camX, int camY, const Map& map) const override;
+    // actors standing on top reach a few pixels above the platform
+    SDL_FRect getInteractionRect() override { return { x, y - 4.0f, float(w), float(h) + 4.0f }; }
+    // solid while resting; a falling platform is just debris
+    bool isSolid() const override { return !falling; }
 
 private:
     bool triggered = false;
@@ -29,6 +33,5 @@ private:
     int tileCount = 1;
 
     // collision helpers
-    void ensureCollisionLayer(Map& map);
     void setCollision(Map& map, int val);
 };
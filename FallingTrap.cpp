@@ -1,11 +1,13 @@
 #include "FallingTrap.h"
 #include "GameObject.h"
 #include "Sound.h"
+#include "Sweep.h"
 #include <iostream>
 
 FallingTrap::FallingTrap(SDL_Renderer* renderer, int tileX, int tileY)
     : WorldObject(renderer, "Assets/Sprites/falling_trap.png", 16, 16)
 {
+    tracked.setOwner("FallingTrap");
 
     x = tileX * Map::TILE_SIZE;
     y = tileY * Map::TILE_SIZE;
@@ -72,7 +74,7 @@ void FallingTrap::update(Map& map) {
         if (--delayTimer <= 0) {
             falling = true;
             velY = 0.5f;
-            if (gSound) gSound->playSfx("fallTrapRelease", 128, true);
+            if (gSound) gSound->playSfx(Sfx::FALLTRAP_RELEASE, 128, true);
         }
         return;
     }
@@ -80,12 +82,25 @@ void FallingTrap::update(Map& map) {
     if (!falling) return;
 
     velY += gravity;
+
+    // Swept fall: stop at the first solid row crossed this tick, even at terminal velocity
+    int leftTile = int(x / Map::TILE_SIZE);
+    int rightTile = int((x + width - 1) / Map::TILE_SIZE);
+    int fromRow = int((y + height - 1) / Map::TILE_SIZE);
+    float prevY = y;
     y += velY;
+    int toRow = int((y + height - 1) / Map::TILE_SIZE);
+    int landRow = -1;
+    for (int ty = (toRow > fromRow ? fromRow + 1 : fromRow); ty <= toRow; ++ty) {
+        if (map.isSolid(leftTile, ty) || map.isSolid(rightTile, ty)) { landRow = ty; break; }
+    }
+    if (landRow >= 0) y = landRow * Map::TILE_SIZE - height;
 
-     if (triggerer && triggerer->obj.alive) {
-            SDL_FRect trapRect = getRect();
+     if (triggerer && triggerer->obj->alive) {
+            SDL_FRect startRect{ x, prevY, float(width), float(height) };
             SDL_FRect actorRect = triggerer->getRect();
-            if (SDL_HasRectIntersectionFloat(&trapRect, &actorRect)) {
+            float t;
+            if (sweptAABB(startRect, 0.0f, y - prevY, actorRect, t)) {
                 // apply damage via GameObject::takeDamage so flashing and knockback occur
                 // attackerX is trap center X so knockback pushes actor away from trap
                 float trapCenterX = x + 16 * 0.5f;
@@ -99,18 +114,12 @@ void FallingTrap::update(Map& map) {
         }
 
     // Ground collision
-    int leftTile = int(x / Map::TILE_SIZE);
-    int rightTile = int((x + width - 1) / Map::TILE_SIZE);
-    int bottomTile = int((y + height - 1) / Map::TILE_SIZE);
-
-    if (map.isSolid(leftTile, bottomTile) ||
-        map.isSolid(rightTile, bottomTile))
+    if (landRow >= 0)
     {
-        y = bottomTile * Map::TILE_SIZE - height;
         falling = false;
         triggered = false;
         finishedFalling = true;
-        if (gSound) gSound->playSfx("fallTrapLand", 128, true);
+        if (gSound) gSound->playSfx(Sfx::FALLTRAP_LAND, 128, true);
     }
 }
 
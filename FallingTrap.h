@@ -9,6 +9,8 @@ public:
     void update(Map& map);
     void remove();
     void checkTrigger(class GameObject& actor, Map& map);
+    // Triggered, falling or waiting to be removed: must keep updating even out of range
+    bool isBusy() const { return triggered || falling || finishedFalling; }
 
 private:
     bool triggered = false;
@@ -3,135 +3,151 @@
 #include "Engine.h"
 #include "PressurePlate.h"
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include <cmath>
 #include <algorithm>
+#include <vector>
+
+// Hot store: fixed pages of hot blocks. Pages are never moved or freed, so a HotRef's pointer
+// stays valid; freed slots go on a free list and are handed out again lowest index first
+// after a level reset (the arena destroys in reverse order).
+namespace {
+    constexpr int kHotPageSize = 256;
+
+    std::vector<GameObject::object*>& hotPages()
+    {
+        static std::vector<GameObject::object*> pages;
+        return pages;
+    }
 
-GameObject::GameObject(SDL_Renderer* renderer, const std::string& spritePath, int tw, int th) {
-    SDL_Surface* surf = IMG_Load(spritePath.c_str());
-    if (!surf && spritePath != "NULL") {
-        SDL_Log("Failed to load sprite: %s", SDL_GetError());
-        return;
+    std::vector<int>& hotFree()
+    {
+        static std::vector<int> free;
+        return free;
     }
-    tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
-    // enable alpha blending for sprites
-    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
-    SDL_DestroySurface(surf);
-
-    // Parameters: texture, frameW, frameH, frames, rowY, innerX, innerY, innerW, innerH
-    obj.tileWidth = tw;     
-    obj.tileHeight = th;
-    animIdle = new AnimationManager(tex, 100, 100, frames.idle, 0, 44, 42, obj.tileWidth, obj.tileHeight);
-    animWalk = new AnimationManager(tex, 100, 100, frames.walk, 100, 44, 42, obj.tileWidth, obj.tileHeight);
-    animAttack = new AnimationManager(tex, 100, 100, frames.attack, 200, 44, 42, obj.tileWidth, obj.tileHeight);
-    animFlash = new AnimationManager(tex, 100, 100, frames.flash, 500, 44, 42, obj.tileWidth, obj.tileHeight);
-    animBlock = new AnimationManager(tex, 100, 100, frames.block, 400, 44, 42, obj.tileWidth, obj.tileHeight);
-    animShoot = new AnimationManager(tex, 100, 100, frames.shoot, 400, 44, 42, obj.tileWidth, obj.tileHeight);
-    animPlayerCharge = new AnimationManager(tex, 100, 100, frames.playerCharge, 400, 44, 42, obj.tileWidth, obj.tileHeight);
-    animPrev = animIdle;
-    currentAnim = animIdle;
+}
 
+GameObject::object& GameObject::hot(int index)
+{
+    return hotPages()[index / kHotPageSize][index % kHotPageSize];
 }
 
-// Called by Frames when a frame count value changes; update live AnimationManager instances accordingly
-void GameObject::onFrameChanged(int which, int newValue)
+GameObject::HotRef::HotRef()
 {
-    using FI = Frames::FrameIndex;
-    switch ((FI)which) {
-    case FI::IDLE:
-        if (animIdle) {
-            animIdle->frameCount = newValue;
-            if (animIdle->currentFrame >= animIdle->frameCount) animIdle->currentFrame = 0;
-        }
-        break;
-    case FI::WALK:
-        if (animWalk) {
-            animWalk->frameCount = newValue;
-            if (animWalk->currentFrame >= animWalk->frameCount) animWalk->currentFrame = 0;
-        }
-        break;
-    case FI::ATTACK:
-        if (animAttack) {
-            animAttack->frameCount = newValue;
-            if (animAttack->currentFrame >= animAttack->frameCount) animAttack->currentFrame = 0;
-        }
-        break;
-    case FI::FLASH:
-        if (animFlash) {
-            animFlash->frameCount = newValue;
-            if (animFlash->currentFrame >= animFlash->frameCount) animFlash->currentFrame = 0;
-        }
-        break;
-    case FI::BLOCK:
-        if (animBlock) {
-            animBlock->frameCount = newValue;
-            if (animBlock->currentFrame >= animBlock->frameCount) animBlock->currentFrame = 0;
-        }
-        break;
-    case FI::SHOOT:
-        if (animShoot) {
-            animShoot->frameCount = newValue;
-            if (animShoot->currentFrame >= animShoot->frameCount) animShoot->currentFrame = 0;
-        }
-        break;
-    case FI::PLAYERCHARGE:
-        if (animPlayerCharge) {
-            animPlayerCharge->frameCount = newValue;
-            if (animPlayerCharge->currentFrame >= animPlayerCharge->frameCount) animPlayerCharge->currentFrame = 0;
+    auto& free = hotFree();
+    if (free.empty()) {
+        int base = int(hotPages().size()) * kHotPageSize;
+        hotPages().push_back(new object[kHotPageSize]);
+        for (int i = kHotPageSize - 1; i >= 0; --i) free.push_back(base + i);
+    }
+    slot = free.back();
+    free.pop_back();
+    block = &hot(slot);
+    *block = object{};
+}
+
+GameObject::HotRef::HotRef(const HotRef& other) : HotRef()
+{
+    *block = *other.block;
+}
+
+GameObject::HotRef::~HotRef()
+{
+    hotFree().push_back(slot);
+}
+
+GameObject::GameObject(SDL_Renderer* renderer, const std::string& spritePath, int tw, int th) {
+    obj->tileWidth = Sint16(tw);
+    obj->tileHeight = Sint16(th);
+    // "NULL" means the subclass draws its own sprite, so there is no sheet to load
+    if (spritePath != "NULL") clips = ClipSet::get(renderer, spritePath, tw, th);
+}
+
+void GameObject::stepFlash()
+{
+    if (!flashing) return;
+    if (--flashTicksLeft > 0) return;
+    if (flashOn) {
+        // turn flash animation off for the off-phase
+        flashOn = false;
+        flashTicksLeft = flashInterval;
+    } else {
+        // completed an off-phase -> one visible pulse consumed
+        --flashCyclesLeft;
+        if (flashCyclesLeft <= 0) {
+            // finished all pulses
+            flashing = false;
+            // ensure we restore previous animation next frame
+            if (animPrev.clip != ClipSet::NONE && anim.clip == ClipSet::FLASH) {
+                anim = animPrev;
+                animPrev.clip = ClipSet::NONE;
+            }
+        } else {
+            // start next visible phase
+            flashOn = true;
+            flashTicksLeft = flashInterval;
         }
-        break;
-    default:
-        break;
     }
 }
 
-SDL_FRect GameObject::getRect() const {
-    return { obj.x, obj.y, 12, 16 };
+void GameObject::wake(int ticks)
+{
+    if (ticks <= 0) return;
+    auto runDown = [ticks](int& t) { t = t > ticks ? t - ticks : 0; };
+    runDown(invulnTimer);
+    runDown(knockbackTimer);
+    obj->ignoreOneWayTimer = Sint16(obj->ignoreOneWayTimer > ticks ? obj->ignoreOneWayTimer - ticks : 0);
+    if (obj->attacking) {
+        obj->attackTimer = Sint16(obj->attackTimer > ticks ? obj->attackTimer - ticks : 0);
+        if (obj->attackTimer <= 0) obj->attacking = false;
+    }
+    // the pulse sequence is short; stepping it keeps the saved animation restore in one place
+    for (int i = 0; i < ticks && flashing; ++i) stepFlash();
+    anim.advance(ticks, clipFrames(anim.clip));
 }
 
 SDL_FRect GameObject::getAttackRect() const {
     // Default behavior: provide a hitbox only during strike frames.
     // Delay the hitbox until later in the attack so global hitstop lines up with the visible swing.
-    if (!obj.attacking)
+    if (!obj->attacking)
         return { 0,0,0,0 };
 
     // Use a common wind-up rule for all game objects: the strike becomes active when
     // attackTimer has counted down into the final two attSpeed units (~4th frame).
-    if (obj.attackTimer > (obj.attSpeed * 2))
+    if (obj->attackTimer > (stats.attSpeed * 2))
         return { 0,0,0,0 };
 
     float w = 18.0f;
     float h = 12.0f;
-    float x = obj.facing ? obj.x + obj.tileWidth : obj.x - w;
-    float y = obj.y + 4;
+    float x = obj->facing ? obj->x + obj->tileWidth : obj->x - w;
+    float y = obj->y + 4;
 
     return { x, y, w, h };
 }
 
 void GameObject::draw(SDL_Renderer* renderer, int camX, int camY) {
-    if (!obj.alive) return;
+    if (!obj->alive || !clips) return;
+        const AnimationClip& clip = (*clips)[anim.clip];
         SDL_FRect dst;
 
         // Scale so inner sprite matches hitbox
-        float scaleX = obj.tileWidth / currentAnim->getInnerW();
-        float scaleY = obj.tileHeight / currentAnim->getInnerH();
+        float scaleX = obj->tileWidth / clip.innerW;
+        float scaleY = obj->tileHeight / clip.innerH;
 
-        dst.w = currentAnim->frameWidth * scaleX;   // full 100x100 scaled
-        dst.h = currentAnim->frameHeight * scaleY;
+        dst.w = clip.frameW * scaleX;   // full 100x100 scaled
+        dst.h = clip.frameH * scaleY;
         // Round destination position to integer pixels to keep pixels sharp
-        float rawX = obj.x - camX - currentAnim->getInnerX() * scaleX;
-        float rawY = obj.y - camY - currentAnim->getInnerY() * scaleY;
+        float rawX = obj->x - camX - clip.innerX * scaleX;
+        float rawY = obj->y - camY - clip.innerY * scaleY;
         dst.x = std::round(rawX);
         dst.y = std::round(rawY) + 1.0f; // shift sprite down 1 pixel so feet align with hitbox
 
-        SDL_FRect src = currentAnim->getSrcRect();
-        SDL_FlipMode flip = obj.facing ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
+        SDL_FRect src = clip.srcRect(anim.frame);
+        SDL_FlipMode flip = obj->facing ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
 
         // no debug rect here
 
         // Render the sprite normally
-        SDL_RenderTextureRotated(renderer, currentAnim->getTexture(), &src, &dst, 0.0, nullptr, flip);
+        SDL_RenderTextureRotated(renderer, clip.texture, &src, &dst, 0.0, nullptr, flip);
 
         SDL_FRect tmpattackRect = this->getAttackRect();
         // Debug draw: convert attack rect (world coordinates) to screen coordinates by subtracting camera.
@@ -150,26 +166,29 @@ void GameObject::draw(SDL_Renderer* renderer, int camX, int camY) {
 
 void GameObject::update(Map& map)
 {
+    obj->prevX = obj->x;
+    obj->prevY = obj->y;
+
     // --------------------
     // Gravity
     // --------------------
-    obj.vely += 0.35f;
-    if (obj.vely > 8.0f)
-        obj.vely = 8.0f;
+    obj->vely += 0.35f;
+    if (obj->vely > 8.0f)
+        obj->vely = 8.0f;
 
     // --------------------
     // Horizontal movement
     // --------------------
     // If configured to avoid edges, detect lack of ground ahead and turn around instead of moving
-    if (obj.avoidEdges && obj.velx != 0 && knockbackTimer <= 0 && !obj.attacking) {
-        float nextX = obj.x + obj.velx;
+    if (obj->avoidEdges && obj->velx != 0 && knockbackTimer <= 0 && !obj->attacking) {
+        float nextX = obj->x + obj->velx;
         int l = int(nextX / map.TILE_SIZE);
-        int r = int((nextX + obj.tileWidth - 1) / map.TILE_SIZE);
-        int t = int(obj.y / map.TILE_SIZE);
-        int b = int((obj.y + obj.tileHeight - 1) / map.TILE_SIZE);
+        int r = int((nextX + obj->tileWidth - 1) / map.TILE_SIZE);
+        int t = int(obj->y / map.TILE_SIZE);
+        int b = int((obj->y + obj->tileHeight - 1) / map.TILE_SIZE);
 
         // Determine front column based on movement direction
-        int frontX = obj.velx > 0 ? r : l;
+        int frontX = obj->velx > 0 ? r : l;
         int footY = b + 1;
 
         bool blockedByEdge = false;
@@ -191,214 +210,127 @@ void GameObject::update(Map& map)
         }
 
         if (blockedByEdge) {
-            obj.facing = !obj.facing;
-            obj.velx = 0;
+            obj->facing = !obj->facing;
+            obj->velx = 0;
             // prevent AI from immediately overriding this flip and moving back onto the edge
             knockbackTimer = 6; // short pause in AI control
             // skip movement this frame
-        } else {
-            obj.x += obj.velx;
         }
-    } else {
-        obj.x += obj.velx;
     }
 
-    int leftTile = int(obj.x / map.TILE_SIZE);
-    int rightTile = int((obj.x + obj.tileWidth - 1) / map.TILE_SIZE);
-    int topTile = int(obj.y / map.TILE_SIZE);
-    int bottomTile = int((obj.y + obj.tileHeight - 1) / map.TILE_SIZE);
-
-    // Horizontal collision
-    if (obj.velx > 0) { // moving right
-        // Treat one-way platforms as non-blocking for horizontal collisions.
-        int colTop = map.getCollision(rightTile, topTile);
-        int colBottom = map.getCollision(rightTile, bottomTile);
-        auto horSolid = [](int col) -> bool { return (col != -1 && col != Map::COLL_ONEWAY); };
-        if (horSolid(colTop) || horSolid(colBottom))
-        {
-            obj.x = rightTile * map.TILE_SIZE - obj.tileWidth;
-            obj.velx = 0.0f;
-        }
-    }
-    else if (obj.velx < 0) { // moving left
-        int colTop = map.getCollision(leftTile, topTile);
-        int colBottom = map.getCollision(leftTile, bottomTile);
-        auto horSolid = [](int col) -> bool { return (col != -1 && col != Map::COLL_ONEWAY); };
-        if (horSolid(colTop) || horSolid(colBottom))
-        {
-            obj.x = (leftTile + 1) * map.TILE_SIZE;
-            obj.velx = 0.0f;
-        }
+    // Horizontal collision: sweep the move so fast movers (charge dash) stop at the first wall.
+    // One-way platforms never block sideways.
+    if (obj->velx != 0.0f) {
+        SDL_FRect box{ obj->x, obj->y, float(obj->tileWidth), float(obj->tileHeight) };
+        float dx = obj->velx;
+        if (map.sweepX(box, dx))
+            obj->velx = 0.0f;
+        obj->x += dx;
     }
 
     // --------------------
     // Vertical movement
     // --------------------
-    // Save previous Y so we can detect coming-from-above for one-way platforms
-    float prevY = obj.y;
+    // Save previous Y so we can detect coming-from-above for pressure plates
+    float prevY = obj->y;
 
-    obj.y += obj.vely;
-
-    leftTile = int(obj.x / map.TILE_SIZE);
-    rightTile = int((obj.x + obj.tileWidth - 1) / map.TILE_SIZE);
-    topTile = int(obj.y / map.TILE_SIZE);
-    bottomTile = int((obj.y + obj.tileHeight - 1) / map.TILE_SIZE);
+    // Swept vertical move: lands on the first floor crossed, one-way platforms only from
+    // above and not while dropping through
+    SDL_FRect box{ obj->x, obj->y, float(obj->tileWidth), float(obj->tileHeight) };
+    float dy = obj->vely;
+    bool hitY = map.sweepY(box, dy, obj->ignoreOneWayTimer <= 0);
+    obj->y += dy;
 
     // Vertical collision
-    if (obj.vely > 0) { // falling
-        // Check both bottom tiles
-        int colLeft = map.getCollision(leftTile, bottomTile);
-        int colRight = map.getCollision(rightTile, bottomTile);
-
-        auto shouldStopOn = [&](int col, int tileY) -> bool {
-            if (col == -1) return false;
-            if (col == Map::COLL_ONEWAY) {
-                // Only stop if we were above the platform in the previous frame
-                float platformTop = float(bottomTile * map.TILE_SIZE);
-                float prevBottom = prevY + obj.tileHeight - 1;
-                if (prevBottom <= platformTop && obj.ignoreOneWayTimer <= 0)
-                    return true;
-                return false;
-            }
-            // Any other non -1 collision is solid
-            return true;
-        };
-
-        if (shouldStopOn(colLeft, bottomTile) || shouldStopOn(colRight, bottomTile))
+    if (obj->vely > 0) { // falling
+        if (hitY)
         {
-            obj.y = bottomTile * map.TILE_SIZE - obj.tileHeight;
-            obj.vely = 0.0f;
-            obj.onGround = true;
+            obj->vely = 0.0f;
+            obj->onGround = true;
         } else {
             // Not landing on normal tiles: check for thin pressure plates underneath so any GameObject can stand on them
-            obj.onGround = false;
+            obj->onGround = false;
             if (gEngine) {
-                float prevBottom = prevY + obj.tileHeight - 1;
-                float currBottom = obj.y + obj.tileHeight;
-                for (auto* mo : gEngine->objects) {
-                    if (!mo || !mo->active) continue;
-                    PressurePlate* pp = dynamic_cast<PressurePlate*>(mo);
-                    if (!pp) continue;
+                float prevBottom = prevY + obj->tileHeight - 1;
+                float currBottom = obj->y + obj->tileHeight;
+                for (auto* pp : gEngine->plates) {
+                    if (!pp->active) continue;
                     SDL_FRect pr = pp->getRect();
                     float plateTop = pr.y + (pr.h - 2.0f);
                     // horizontal overlap
-                    float overlapX = std::min(obj.x + obj.tileWidth, pr.x + pr.w) - std::max(obj.x, pr.x);
+                    float overlapX = std::min(obj->x + obj->tileWidth, pr.x + pr.w) - std::max(obj->x, pr.x);
                     if (overlapX <= 0) continue;
                     // require downward crossing of the plate top
-                    if (prevBottom < plateTop && currBottom >= plateTop && obj.vely >= 0.0f) {
-                        obj.y = plateTop - obj.tileHeight;
-                        obj.vely = 0.0f;
-                        obj.onGround = true;
+                    if (prevBottom < plateTop && currBottom >= plateTop && obj->vely >= 0.0f) {
+                        obj->y = plateTop - obj->tileHeight;
+                        obj->vely = 0.0f;
+                        obj->onGround = true;
                         break;
                     }
                 }
             }
         }
     }
-    else if (obj.vely < 0) { // jumping / hitting ceiling
-        // One-way platforms should NOT block you when going up; treat ONLY non-one-way as solid
-        int colLeftTop = map.getCollision(leftTile, topTile);
-        int colRightTop = map.getCollision(rightTile, topTile);
-
-        auto isSolidCeil = [&](int col) -> bool {
-            if (col == -1) return false;
-            if (col == Map::COLL_ONEWAY) return false; // allow passing up through one-way
-            return true;
-        };
-
-        if (isSolidCeil(colLeftTop) || isSolidCeil(colRightTop))
-        {
-            obj.y = (topTile + 1) * map.TILE_SIZE;
-            obj.vely = 0.0f;
-        }
+    else if (obj->vely < 0) { // jumping / hitting ceiling
+        // One-way platforms should NOT block you when going up (sweepY ignores them)
+        if (hitY)
+            obj->vely = 0.0f;
     }
 
     // --------------------
     // Attack timing
     // --------------------
-    if (obj.attacking && --obj.attackTimer <= 0)
-        obj.attacking = false;
+    if (obj->attacking && --obj->attackTimer <= 0)
+        obj->attacking = false;
 
     // --------------------
     // Animation selection
     // --------------------
     if (preventAnimOverride) {
-        // Caller requested to preserve currentAnim; just update flip/speed as-is and advance animation.
-        currentAnim->setFlip(!obj.facing);
-        currentAnim->update();
+        // Caller requested to preserve the current clip; it is just advanced below.
     }
     else if (flashing && flashOn) {
-         // swap to flashing animation (save previous)
-         if (currentAnim != animFlash) {
-             animPrev = currentAnim;
-             currentAnim = animFlash;
+         // swap to flashing clip (save previous playhead)
+         if (anim.clip != ClipSet::FLASH) {
+             animPrev = anim;
+             anim.play(ClipSet::FLASH);
+             anim.speed = 10;
          }
      } else {
-        // not currently showing flash animation
-        if (animPrev && currentAnim == animFlash) {
-            currentAnim = animPrev;
-            animPrev = nullptr;
+        // not currently showing flash clip
+        if (animPrev.clip != ClipSet::NONE && anim.clip == ClipSet::FLASH) {
+            anim = animPrev;
+            animPrev.clip = ClipSet::NONE;
         }
 
         // New: blocking animation takes precedence
-        if (blocking && animBlock) {
-            currentAnim = animBlock;
-            currentAnim->setSpeed(10);
+        if (blocking) {
+            anim.set(ClipSet::BLOCK);
+            anim.speed = 10;
         }
-        else if (obj.attacking) {
-            // If a ranged "shoot" animation exists and was explicitly selected by the caller
-            // (currentAnim == animShoot), preserve it. Otherwise fall back to the melee attack anim.
-            if (animShoot && currentAnim == animShoot) {
-                currentAnim->setSpeed(obj.attSpeed);
-            } else {
-                currentAnim = animAttack;
-                currentAnim->setSpeed(obj.attSpeed);
-            }
+        else if (obj->attacking) {
+            // If the ranged shoot clip was explicitly selected by the caller, preserve it.
+            // Otherwise fall back to the melee attack clip.
+            if (anim.clip != ClipSet::SHOOT) anim.set(ClipSet::ATTACK);
+            anim.speed = Uint8(stats.attSpeed);
         }
-        else if (obj.velx != 0) {
-            currentAnim = animWalk;
-            currentAnim->setSpeed(10);
+        else if (obj->velx != 0) {
+            anim.set(ClipSet::WALK);
+            anim.speed = 10;
         }
         else {
-            currentAnim = animIdle;
-            currentAnim->setSpeed(10);
+            anim.set(ClipSet::IDLE);
+            anim.speed = 10;
         }
     }
 
-    // After selecting currentAnim, advance its frame when not preserving via preventAnimOverride.
-    if (!preventAnimOverride && currentAnim) {
-        currentAnim->setFlip(!obj.facing);
-        currentAnim->update();
-    }
+    // After selecting the clip, advance its frame
+    if (clips) anim.update(clipFrames(anim.clip));
 
     // --------------------
     // Flashing update (swap animation pulses)
     // --------------------
-    if (flashing) {
-        if (--flashTicksLeft <= 0) {
-            if (flashOn) {
-                // turn flash animation off for the off-phase
-                flashOn = false;
-                flashTicksLeft = flashInterval;
-            } else {
-                // completed an off-phase -> one visible pulse consumed
-                --flashCyclesLeft;
-                if (flashCyclesLeft <= 0) {
-                    // finished all pulses
-                    flashing = false;
-                    // ensure we restore previous animation next frame
-                    if (animPrev && currentAnim == animFlash) {
-                        currentAnim = animPrev;
-                        animPrev = nullptr;
-                    }
-                } else {
-                    // start next visible phase
-                    flashOn = true;
-                    flashTicksLeft = flashInterval;
-                }
-            }
-        }
-    }
+    stepFlash();
 
     // --------------------
     // Invulnerability timer (prevents multiple hits per attack)
@@ -415,8 +347,8 @@ void GameObject::update(Map& map)
     // --------------------
     // Decrement drop-through timer (if set by player)
     // --------------------
-    if (obj.ignoreOneWayTimer > 0)
-        --obj.ignoreOneWayTimer;
+    if (obj->ignoreOneWayTimer > 0)
+        --obj->ignoreOneWayTimer;
 
     // --------------------
     // Clamp to map bounds so objects/players cannot fall out of the world
@@ -425,26 +357,26 @@ void GameObject::update(Map& map)
         int worldW = map.width * map.TILE_SIZE;
         int worldH = map.height * map.TILE_SIZE;
 
-        if (obj.x < 0.0f) obj.x = 0.0f;
-        if (obj.x + obj.tileWidth > worldW) obj.x = float(worldW - obj.tileWidth);
+        if (obj->x < 0.0f) obj->x = 0.0f;
+        if (obj->x + obj->tileWidth > worldW) obj->x = float(worldW - obj->tileWidth);
 
-        if (obj.y < 0.0f) {
-            obj.y = 0.0f;
-            obj.vely = 0.0f;
+        if (obj->y < 0.0f) {
+            obj->y = 0.0f;
+            obj->vely = 0.0f;
         }
-        if (obj.y + obj.tileHeight > worldH) {
-            obj.y = float(worldH - obj.tileHeight);
-            obj.vely = 0.0f;
-            obj.onGround = true;
+        if (obj->y + obj->tileHeight > worldH) {
+            obj->y = float(worldH - obj->tileHeight);
+            obj->vely = 0.0f;
+            obj->onGround = true;
         }
     }
 
     // If this GameObject is marked to avoid edges and somehow ended up standing on a portal
     // (spawn tile 96..99), push it off the portal and flip to avoid getting stuck.
-    if (obj.avoidEdges && !map.spawn.empty()) {
-        int leftTile = int(obj.x / map.TILE_SIZE);
-        int rightTile = int((obj.x + obj.tileWidth - 1) / map.TILE_SIZE);
-        int bottomTile = int((obj.y + obj.tileHeight - 1) / map.TILE_SIZE);
+    if (obj->avoidEdges && !map.spawn.empty()) {
+        int leftTile = int(obj->x / map.TILE_SIZE);
+        int rightTile = int((obj->x + obj->tileWidth - 1) / map.TILE_SIZE);
+        int bottomTile = int((obj->y + obj->tileHeight - 1) / map.TILE_SIZE);
 
         if (bottomTile >= 0 && bottomTile < map.height) {
             // check both tiles under the object's feet
@@ -454,16 +386,16 @@ void GameObject::update(Map& map)
                 if (sp == 96 || sp == 97 || sp == 98 || sp == 99) {
                     // Nudge the object off this tile depending on approach
                     // If object center is left of tile center, push to left; otherwise push to right
-                    float center = obj.x + obj.tileWidth * 0.5f;
+                    float center = obj->x + obj->tileWidth * 0.5f;
                     float tileCenter = tx * map.TILE_SIZE + map.TILE_SIZE * 0.5f;
                     if (center < tileCenter) {
-                        obj.x = float(tx * map.TILE_SIZE) - obj.tileWidth; // place left
-                        obj.facing = true; // face right after nudging
+                        obj->x = float(tx * map.TILE_SIZE) - obj->tileWidth; // place left
+                        obj->facing = true; // face right after nudging
                     } else {
-                        obj.x = float((tx + 1) * map.TILE_SIZE);
-                        obj.facing = false; // face left after nudging
+                        obj->x = float((tx + 1) * map.TILE_SIZE);
+                        obj->facing = false; // face left after nudging
                     }
-                    obj.velx = 0.0f;
+                    obj->velx = 0.0f;
                     knockbackTimer = 6;
                     return true;
                 }
@@ -507,11 +439,11 @@ void GameObject::takeDamage(
     // --------------------
     // Apply damage
     // --------------------
-    obj.health -= amount;
-    if (obj.health <= 0.0f) {
-        obj.health = 0.0f;
+    stats.health -= amount;
+    if (stats.health <= 0.0f) {
+        stats.health = 0.0f;
         if (gSound) gSound->playSfx(audio.deathSfx);
-        obj.alive = false;
+        obj->alive = false;
     }
 
     // --------------------
@@ -543,25 +475,25 @@ void GameObject::takeDamage(
     // --------------------
     float magX = fabs(kbX);
 
-    float myCenter = obj.x + obj.tileWidth * 0.5f;
+    float myCenter = obj->x + obj->tileWidth * 0.5f;
 
     // If I'm left of the attacker → go left
     // If I'm right of the attacker → go right
     float sign = (myCenter < attackerX) ? -1.0f : 1.0f;
 
-    obj.velx = sign * magX;
+    obj->velx = sign * magX;
 
     // Safety clamp so knockback is never zero
-    if (fabs(obj.velx) < 0.1f)
-        obj.velx = sign * magX;
+    if (fabs(obj->velx) < 0.1f)
+        obj->velx = sign * magX;
 
     // --------------------
     // Vertical knockback
     // Small lift only if grounded
     // --------------------
-    if (obj.onGround && kbY != 0.0f) {
-        obj.vely = kbY * 0.5f;   // tune this multiplier as needed
-        obj.onGround = false;
+    if (obj->onGround && kbY != 0.0f) {
+        obj->vely = kbY * 0.5f;   // tune this multiplier as needed
+        obj->onGround = false;
     }
 
     // --------------------
@@ -1,88 +1,89 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include "Map.h"
-#include "AnimationManager.h"
+#include "AnimationClip.h"
+#include "Sound.h"
+#include "ResourceTracker.h"
 class GameObject
 {
 public:
+    // Hot state: what movement, collision, attacks and the enemy passes touch every tick.
+    // The blocks of all live GameObjects are packed side by side in one store (hot()), so a
+    // pass over every actor walks contiguous memory instead of whole objects. Rarely touched
+    // values live in `stats`.
     struct object {
-        int tileWidth = 12;
-        int tileHeight = 16;
         float x = 50, y = 100;
         float velx = 0, vely = 0;
-        bool onGround = false;
-        bool facing = true;
-        bool attackKeyPressed = false;
-        int attSpeed = 5;
-        bool attacking = false;
-        float attackTimer = 0;
-        bool alive = true;
+        float prevX = 50, prevY = 100; // position at the start of the last update()
+        Sint16 tileWidth = 12;
+        Sint16 tileHeight = 16;
+        Sint16 ignoreOneWayTimer = 0;
+        Sint16 attackTimer = 0;    // ticks left in the current attack (getAttackRect reads it)
+        bool onGround : 1 = false;
+        bool facing : 1 = true;
+        bool attacking : 1 = false;
+        bool alive : 1 = true;
+        bool canMove : 1 = true;
+        // avoid stepping off map edges while patrolling (checked every move)
+        bool avoidEdges : 1 = false;
+    };
+    static_assert(sizeof(object) <= 40, "GameObject::object is the hot block; keep it small");
+
+    // Handle to this object's block in the hot store. A copy takes a new block holding the
+    // same values, so prototype clones get blocks of their own.
+    class HotRef {
+    public:
+        HotRef();
+        HotRef(const HotRef& other);
+        HotRef& operator=(const HotRef& other) { *block = *other.block; return *this; }
+        ~HotRef();
+
+        object* operator->() const { return block; }
+        object& operator*() const { return *block; }
+        int index() const { return slot; }
+
+    private:
+        object* block;
+        int slot;
+    };
+    HotRef obj;
+
+    // Block `index` of the hot store; blocks never move while their owner is alive
+    static object& hot(int index);
+
+    // Shared clips for this object's sprite sheet (nullptr for objects that draw themselves)
+    const ClipSet* clips = nullptr;
+    AnimPlayhead anim;                        // clip currently shown
+    AnimPlayhead animPrev{ ClipSet::NONE };   // saved playhead to restore after flash
+    int clipFrames(Uint8 id) const { return clips ? (*clips)[id].frameCount : 1; }
+
+    struct Audio {
+        SfxId hitSfx = Sfx::HIT;
+        SfxId walkSfx = Sfx::WALK;
+        SfxId deathSfx = Sfx::DEATH;
+    } audio;
+
+    // Cold state: combat stats and input latches, read on hits, pickups and attack starts
+    struct Stats {
         float health = 100.0f;
         float maxHealth = 100.0f;
         float magic = 100.0f;      // current magic/mana
         float maxMagic = 100.0f;   // maximum magic/mana
         int damage = 10;
-        bool canMove = true;
-        int ignoreOneWayTimer = 0;
-        // When true, this instance will avoid stepping off map edges while patrolling
-        bool avoidEdges = false;
-    }; object obj;
-
-    // notify hook used by Frames to update live AnimationManager instances
-    void onFrameChanged(int which, int newValue);
-    SDL_Texture* tex;
-    struct Frames
-    {
-        enum FrameIndex { IDLE = 0, WALK = 1, ATTACK = 2, FLASH = 3, BLOCK = 4, SHOOT = 5, PLAYERCHARGE = 6 };
-
-        struct FrameValue {
-            FrameValue() : owner(nullptr), index(IDLE), v(0) {}
-            FrameValue(GameObject* o, FrameIndex i, int init) : owner(o), index(i), v(init) {}
-            operator int() const { return v; }
-            FrameValue& operator=(int nv) { if (v != nv) { v = nv; if (owner) owner->onFrameChanged((int)index, v); } return *this; }
-            GameObject* owner;
-            FrameIndex index;
-            int v;
-        };
-
-        Frames(GameObject* owner)
-            : idle(owner, IDLE, 6), walk(owner, WALK, 8), attack(owner, ATTACK, 9), flash(owner, FLASH, 4),
-              block(owner, BLOCK, 4), shoot(owner, SHOOT, 9), playerCharge(owner, PLAYERCHARGE, 12)
-        {}
-
-        // implicit conversion to ints supported via FrameValue::operator int()
-        FrameValue idle;
-        FrameValue walk;
-        FrameValue attack;
-        FrameValue flash;
-        FrameValue block;
-        FrameValue shoot;
-        FrameValue playerCharge;
-    } frames{this};
-
-    struct Audio {
-        const char* hitSfx = "hit";
-        const char* walkSfx = "walk";
-        const char* deathSfx = "death";
-    } audio;
-
-    AnimationManager* animIdle;
-    AnimationManager* animWalk;
-    AnimationManager* animAttack;
-    AnimationManager* currentAnim;
-    AnimationManager* animFlash; // flashing sprite animation
-    AnimationManager* animPrev;  // saved animation to restore after flash
-    AnimationManager* animBlock; // blocking animation (added)
-    AnimationManager* animShoot; // shooting animation (for ranged enemies)
-    AnimationManager* animPlayerCharge; // players charge animation
+        int attSpeed = 5;
+        bool attackKeyPressed = false;
+    } stats;
 
 public:
     GameObject(SDL_Renderer* renderer, const std::string& spritePath, int tw, int th);
+    virtual ~GameObject() = default;
 
     void draw(SDL_Renderer* renderer, int camX, int camY);
     void update(Map& map);
 
-    SDL_FRect getRect() const;
+    SDL_FRect getRect() const { return bodyRect(*obj); }
+    // Body rect of a hot block (passes that walk the hot store use this directly)
+    static SDL_FRect bodyRect(const object& o) { return { o.x, o.y, 12, 16 }; }
     virtual SDL_FRect getAttackRect() const;
 
     // Start the flash pulse sequence (declared so other systems can trigger it)
@@ -94,7 +95,15 @@ public:
     // `kbX`/`kbY` are knockback velocity components; `kbTicks` is how long AI movement is suppressed.
     void takeDamage(float amount, float attackerX, int flashes = 3, int intervalTicks = 6, int invulnTicks = 30, float kbX = 2.5f, float kbY = -4.0f, int kbTicks = 12);
 
+    // Activation: the engine skips actors far from the camera and counts the skipped ticks;
+    // wake() runs the timers and current animation forward by that many ticks.
+    int sleptTicks = 0;
+    virtual void wake(int ticks);
+
 protected:
+    // Advance the flash pulse sequence by one tick
+    void stepFlash();
+
     // Flashing state
     bool flashing = false; // whether flash sequence active
     bool flashOn = false;        // whether flashing animation is currently active
@@ -105,7 +114,7 @@ protected:
     // Damage / invulnerability
     int invulnTimer = 0;        // remaining invulnerability ticks
 
-    // Knockback: while >0, AI movement should not override obj.velx
+    // Knockback: while >0, AI movement should not override obj->velx
     int knockbackTimer = 0;    // remaining ticks to keep knockback
 
     // Blocking state (for enemies that can block)
@@ -115,4 +124,7 @@ protected:
     // selection step. Derived classes can set this to preserve a custom animation.
     bool preventAnimOverride = false;
 	bool showRectDebug = false;
+
+    // live-entity count for leak reports; subclasses name it after themselves
+    ResourceTracker::Token tracked{ ResourceTracker::ENTITY, "GameObject" };
 };
\ No newline at end of file
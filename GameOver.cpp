@@ -1,9 +1,11 @@
 #include "GameOver.h"
+#include "ResourceTracker.h"
 #include <SDL3/SDL.h>
-#include <SDL3_ttf/SDL_ttf.h>
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
 #include <cmath>
+#include "GlyphAtlas.h"
+#include "UiLayer.h"
 
 GameOver::GameOver(SDL_Renderer* renderer, float viewScale_) : viewScale(viewScale_) {
     options.push_back("Restart");
@@ -12,7 +14,7 @@ GameOver::GameOver(SDL_Renderer* renderer, float viewScale_) : viewScale(viewSca
     // load background image (reuse Menu background)
     SDL_Surface* surf = IMG_Load("Assets/Menu/gameover.png");
     if (surf) {
-        bgTex = SDL_CreateTextureFromSurface(renderer, surf);
+        bgTex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "GameOver", ResourceTracker::SESSION);
         if (bgTex) SDL_SetTextureScaleMode(bgTex, SDL_SCALEMODE_NEAREST);
         SDL_DestroySurface(surf);
     } else {
@@ -20,21 +22,20 @@ GameOver::GameOver(SDL_Renderer* renderer, float viewScale_) : viewScale(viewSca
         bgTex = nullptr;
     }
 
-    if (!TTF_Init()) {
-        SDL_Log("GameOver: TTF_Init failed: %s", SDL_GetError());
-        font = nullptr;
-    } else {
-        font = TTF_OpenFont("Assets/Fonts/font.ttf", (float)fontSize);
-        if (!font) {
-            SDL_Log("GameOver: Failed to load font: %s", SDL_GetError());
-        }
+    font = GlyphAtlas::get(renderer, "Assets/Fonts/font.ttf", fontSize);
+    if (!font) {
+        SDL_Log("GameOver: Failed to load font: %s", SDL_GetError());
     }
+
+    int lw = 320, lh = 240;
+    SDL_GetRenderLogicalPresentation(renderer, &lw, &lh, nullptr);
+    layer = new UiLayer(float(lw) / viewScale, float(lh) / viewScale, viewScale);
 }
 
 GameOver::~GameOver() {
-    if (font) { TTF_CloseFont(font); font = nullptr; }
-    if (bgTex) { SDL_DestroyTexture(bgTex); bgTex = nullptr; }
-    TTF_Quit();
+    font = nullptr; // shared atlas, released by the engine
+    delete layer; layer = nullptr;
+    if (bgTex) { ResourceTracker::destroyTexture(bgTex); bgTex = nullptr; }
 }
 
 void GameOver::handleInput(const bool* keys) {
@@ -42,8 +43,8 @@ void GameOver::handleInput(const bool* keys) {
     bool down = keys[SDL_SCANCODE_S] || keys[SDL_SCANCODE_DOWN];
     bool enter = keys[SDL_SCANCODE_RETURN] || keys[SDL_SCANCODE_SPACE];
 
-    if (up && !upLastKbd) selected = (selected - 1 + (int)options.size()) % (int)options.size();
-    if (down && !downLastKbd) selected = (selected + 1) % (int)options.size();
+    if (up && !upLastKbd) moveSelection(-1);
+    if (down && !downLastKbd) moveSelection(1);
     if (enter && !enterLastKbd) activated = true;
 
     upLastKbd = up; downLastKbd = down; enterLastKbd = enter;
@@ -54,29 +55,35 @@ void GameOver::handleInput(const Controller::State& cs) {
     bool down = cs.down;
     bool enter = cs.attack || cs.jump;
 
-    if (up && !upLastCtrl) selected = (selected - 1 + (int)options.size()) % (int)options.size();
-    if (down && !downLastCtrl) selected = (selected + 1) % (int)options.size();
+    if (up && !upLastCtrl) moveSelection(-1);
+    if (down && !downLastCtrl) moveSelection(1);
     if (enter && !enterLastCtrl) activated = true;
 
     upLastCtrl = up; downLastCtrl = down; enterLastCtrl = enter;
 }
 
+void GameOver::moveSelection(int delta) {
+    selected = (selected + delta + (int)options.size()) % (int)options.size();
+    if (layer) layer->invalidate();
+}
+
 void GameOver::update() { }
 
-static SDL_Texture* createTextTexture(SDL_Renderer* renderer, TTF_Font* font, const std::string& text, SDL_Color color, float& outW, float& outH) {
-    if (!font) return nullptr;
-    SDL_Surface* surf = TTF_RenderText_Solid(font, text.c_str(), 0, color);
-    if (!surf) return nullptr;
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    if (tex) SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
-    float w = 0, h = 0;
-    SDL_GetTextureSize(tex, &w, &h);
-    outW = w; outH = h;
-    SDL_free(surf);
-    return tex;
+void GameOver::render(SDL_Renderer* renderer) {
+    // Re-composite only when the selection changed; otherwise blit the cached screen
+    if (layer && layer->isDirty()) {
+        if (!layer->begin(renderer)) {
+            compose(renderer);
+            return;
+        }
+        compose(renderer);
+        layer->end(renderer);
+    }
+    if (layer) layer->draw(renderer, 0.0f, 0.0f);
+    else compose(renderer);
 }
 
-void GameOver::render(SDL_Renderer* renderer) {
+void GameOver::compose(SDL_Renderer* renderer) {
     // Draw background or fallback color
     if (bgTex) {
         float w = 0, h = 0;
@@ -89,6 +96,7 @@ void GameOver::render(SDL_Renderer* renderer) {
         SDL_RenderClear(renderer);
     }
 
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     float uiScale = 1.0f / viewScale;
     float baseX = 80.0f * uiScale;
     float baseY = 50.0f * uiScale;
@@ -99,13 +107,7 @@ void GameOver::render(SDL_Renderer* renderer) {
     // Title
     if (font) {
         SDL_Color col = { 255, 255, 255, 255 };
-        float tw, th;
-        SDL_Texture* titleTex = createTextTexture(renderer, font, "Game Over", col, tw, th);
-        if (titleTex) {
-            SDL_FRect dst{ 45 , 10.0f, tw, th };
-            SDL_RenderTexture(renderer, titleTex, nullptr, &dst);
-            SDL_DestroyTexture(titleTex);
-        }
+        font->draw(renderer, "Game Over", 45.0f, 10.0f, col);
     }
 
     for (size_t i = 0; i < options.size(); ++i) {
@@ -118,13 +120,9 @@ void GameOver::render(SDL_Renderer* renderer) {
 
         if (font) {
             SDL_Color textColor = { 0, 0, 0, 255 };
-            float tw = 0, th = 0;
-            SDL_Texture* tex = createTextTexture(renderer, font, options[i], textColor, tw, th);
-            if (tex) {
-                SDL_FRect dst{ r.x + (r.w - tw) * 0.5f, r.y + (r.h - th) * 0.5f, tw, th };
-                SDL_RenderTexture(renderer, tex, nullptr, &dst);
-                SDL_DestroyTexture(tex);
-            }
+            float tw = font->measure(options[i]);
+            float th = float(font->lineHeight());
+            font->draw(renderer, options[i], r.x + (r.w - tw) * 0.5f, r.y + (r.h - th) * 0.5f, textColor);
         }
     }
 }
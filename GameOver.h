@@ -3,7 +3,9 @@
 #include <vector>
 #include <string>
 #include "Controller.h"
-#include <SDL3_ttf/SDL_ttf.h>
+
+class GlyphAtlas;
+class UiLayer;
 
 class GameOver {
 public:
@@ -21,6 +23,9 @@ public:
     int consumeSelection();
 
 private:
+    void compose(SDL_Renderer* renderer);
+    void moveSelection(int delta);
+
     std::vector<std::string> options;
     int selected = 0;
     bool activated = false;
@@ -33,10 +38,13 @@ private:
     bool downLastCtrl = false;
     bool enterLastCtrl = false;
 
-    // font
-    TTF_Font* font = nullptr;
+    // font (shared glyph atlas)
+    GlyphAtlas* font = nullptr;
     int fontSize = 18;
 
     // a simple darkened background texture optional
     SDL_Texture* bgTex = nullptr;
+
+    // cached composited screen; redrawn only when the selection changes
+    UiLayer* layer = nullptr;
 };
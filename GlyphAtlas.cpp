@@ -0,0 +1,156 @@
+#include "GlyphAtlas.h"
+#include "ResourceTracker.h"
+#include <SDL3_ttf/SDL_ttf.h>
+#include <algorithm>
+
+// Atlases are shared by font path + size; text users hold plain pointers into this cache
+static std::vector<GlyphAtlas*> sAtlases;
+static bool sInitedTTF = false;
+
+GlyphAtlas* GlyphAtlas::get(SDL_Renderer* renderer, const std::string& fontPath, int fontSize)
+{
+    if (!renderer) return nullptr;
+
+    for (auto* a : sAtlases) {
+        if (a->fontSize == fontSize && a->fontPath == fontPath) return a->texture ? a : nullptr;
+    }
+
+    if (TTF_WasInit() == 0) {
+        if (!TTF_Init()) {
+            SDL_Log("GlyphAtlas: TTF_Init failed: %s", SDL_GetError());
+            return nullptr;
+        }
+        sInitedTTF = true;
+    }
+
+    GlyphAtlas* atlas = new GlyphAtlas(fontPath, fontSize);
+    atlas->build(renderer);
+    // keep failed atlases too so a missing font is only reported once
+    sAtlases.push_back(atlas);
+    return atlas->texture ? atlas : nullptr;
+}
+
+void GlyphAtlas::releaseAll()
+{
+    for (auto* a : sAtlases) delete a;
+    sAtlases.clear();
+    if (sInitedTTF) {
+        TTF_Quit();
+        sInitedTTF = false;
+    }
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    if (texture) {
+        ResourceTracker::destroyTexture(texture);
+        texture = nullptr;
+    }
+}
+
+bool GlyphAtlas::build(SDL_Renderer* renderer)
+{
+    TTF_Font* font = TTF_OpenFont(fontPath.c_str(), (float)fontSize);
+    if (!font) {
+        SDL_Log("GlyphAtlas: failed to open font '%s': %s", fontPath.c_str(), SDL_GetError());
+        return false;
+    }
+
+    // Rasterise each glyph once (white, no AA) and remember where it goes in the atlas
+    const int count = LAST_GLYPH - FIRST_GLYPH + 1;
+    SDL_Surface* surfs[count] = {};
+    const SDL_Color white{ 255, 255, 255, 255 };
+    int penX = 0, penY = 0, rowH = 0;
+    for (int i = 0; i < count; ++i) {
+        char str[2] = { char(FIRST_GLYPH + i), 0 };
+        int w = 0, h = 0;
+        TTF_GetStringSize(font, str, 1, &w, &h);
+        glyphs[i].advance = float(w);
+        glyphH = std::max(glyphH, h);
+
+        if (str[0] == ' ') continue; // blank, advance only
+        surfs[i] = TTF_RenderText_Solid(font, str, 1, white);
+        if (!surfs[i]) continue;
+
+        // simple shelf packing with 1px padding so nearest sampling never bleeds
+        if (penX + surfs[i]->w + 1 > ATLAS_W) {
+            penX = 0;
+            penY += rowH + 1;
+            rowH = 0;
+        }
+        glyphs[i].src = { float(penX), float(penY), float(surfs[i]->w), float(surfs[i]->h) };
+        penX += surfs[i]->w + 1;
+        rowH = std::max(rowH, surfs[i]->h);
+    }
+    TTF_CloseFont(font);
+
+    int atlasHeight = std::max(1, penY + rowH);
+    SDL_Surface* sheet = SDL_CreateSurface(ATLAS_W, atlasHeight, SDL_PIXELFORMAT_RGBA32);
+    if (sheet) {
+        // new surfaces are zeroed, i.e. fully transparent; blitting honours the glyph colorkey
+        for (int i = 0; i < count; ++i) {
+            if (!surfs[i]) continue;
+            SDL_Rect dst{ int(glyphs[i].src.x), int(glyphs[i].src.y), surfs[i]->w, surfs[i]->h };
+            SDL_BlitSurface(surfs[i], nullptr, sheet, &dst);
+        }
+        texture = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, sheet), "GlyphAtlas", ResourceTracker::SESSION);
+        SDL_DestroySurface(sheet);
+    }
+    for (int i = 0; i < count; ++i) {
+        if (surfs[i]) SDL_DestroySurface(surfs[i]);
+    }
+
+    if (!texture) {
+        SDL_Log("GlyphAtlas: failed to create atlas for '%s': %s", fontPath.c_str(), SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    atlasW = float(ATLAS_W);
+    atlasH = float(atlasHeight);
+    return true;
+}
+
+float GlyphAtlas::measure(const std::string& text) const
+{
+    float w = 0.0f;
+    for (unsigned char c : text) {
+        if (c < FIRST_GLYPH || c > LAST_GLYPH) continue;
+        w += glyphs[c - FIRST_GLYPH].advance;
+    }
+    return w;
+}
+
+void GlyphAtlas::draw(SDL_Renderer* renderer, const std::string& text, float x, float y, SDL_Color color, float scale)
+{
+    if (!renderer || !texture || text.empty()) return;
+
+    verts.clear();
+    indices.clear();
+    const SDL_FColor fc{ color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+
+    float penX = x;
+    for (unsigned char c : text) {
+        if (c < FIRST_GLYPH || c > LAST_GLYPH) continue;
+        const Glyph& g = glyphs[c - FIRST_GLYPH];
+        if (g.src.w > 0.0f) {
+            float x0 = penX, y0 = y;
+            float x1 = penX + g.src.w * scale, y1 = y + g.src.h * scale;
+            float u0 = g.src.x / atlasW, v0 = g.src.y / atlasH;
+            float u1 = (g.src.x + g.src.w) / atlasW, v1 = (g.src.y + g.src.h) / atlasH;
+
+            int base = (int)verts.size();
+            verts.push_back({ { x0, y0 }, fc, { u0, v0 } });
+            verts.push_back({ { x1, y0 }, fc, { u1, v0 } });
+            verts.push_back({ { x1, y1 }, fc, { u1, v1 } });
+            verts.push_back({ { x0, y1 }, fc, { u0, v1 } });
+            indices.push_back(base + 0); indices.push_back(base + 1); indices.push_back(base + 2);
+            indices.push_back(base + 0); indices.push_back(base + 2); indices.push_back(base + 3);
+        }
+        penX += g.advance * scale;
+    }
+
+    if (!verts.empty()) {
+        SDL_RenderGeometry(renderer, texture, verts.data(), (int)verts.size(), indices.data(), (int)indices.size());
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+// Bitmap font atlas shared by all text drawing code.
+// - every printable ASCII glyph of a font/size is rasterised once into a single texture
+// - strings are drawn as one batch of textured quads (one SDL_RenderGeometry call)
+// - glyphs are white in the atlas so the draw color tints them (shadows, menus, hints)
+class GlyphAtlas {
+public:
+    // Shared atlas for a font file and point size; built on first request.
+    // Returns nullptr if the font could not be loaded.
+    static GlyphAtlas* get(SDL_Renderer* renderer, const std::string& fontPath, int fontSize);
+    // Destroy all cached atlases (call before destroying the renderer)
+    static void releaseAll();
+
+    // Width in atlas pixels of a single-line string (before `scale`)
+    float measure(const std::string& text) const;
+    int lineHeight() const { return glyphH; }
+
+    // Draw a single-line string with its top-left corner at (x, y)
+    void draw(SDL_Renderer* renderer, const std::string& text, float x, float y, SDL_Color color, float scale = 1.0f);
+
+private:
+    GlyphAtlas(const std::string& fontPath, int fontSize) : fontPath(fontPath), fontSize(fontSize) {}
+    ~GlyphAtlas();
+
+    bool build(SDL_Renderer* renderer);
+
+    static constexpr int FIRST_GLYPH = 32;  // ' '
+    static constexpr int LAST_GLYPH = 126;  // '~'
+    static constexpr int ATLAS_W = 256;     // atlas width in pixels; height grows as needed
+
+    struct Glyph {
+        SDL_FRect src{ 0, 0, 0, 0 }; // location in the atlas (w == 0 for blank glyphs)
+        float advance = 0.0f;        // pen advance in pixels
+    };
+
+    std::string fontPath;
+    int fontSize = 16;
+    SDL_Texture* texture = nullptr;
+    float atlasW = 0.0f, atlasH = 0.0f;
+    int glyphH = 0;
+    Glyph glyphs[LAST_GLYPH - FIRST_GLYPH + 1];
+
+    // scratch buffers reused by draw() so batching does not allocate every frame
+    std::vector<SDL_Vertex> verts;
+    std::vector<int> indices;
+};
@@ -1,14 +1,19 @@
 #include "Hud.h"
+#include "ResourceTracker.h"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
+#include "UiLayer.h"
 
-Hud::Hud(SDL_Renderer* renderer, const std::string& spritePath)
+Hud::Hud(SDL_Renderer* renderer, const std::string& spritePath, float viewScale)
 {
+    // heart + magic + key at 1.5x with 4px margins/spacing (see compose)
+    layer = new UiLayer(72.0f, 24.0f, viewScale);
+
     SDL_Surface* surf = IMG_Load(spritePath.c_str());
     if (surf) {
         // Create original texture
-        tex = SDL_CreateTextureFromSurface(renderer, surf);
+        tex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Hud", ResourceTracker::SESSION);
         SDL_DestroySurface(surf);
 
         if (tex) {
@@ -22,7 +27,7 @@ Hud::Hud(SDL_Renderer* renderer, const std::string& spritePath)
     // Try to load a separate magic sprite (same directory assumed)
     SDL_Surface* msurf = IMG_Load("Assets/Sprites/magic.png");
     if (msurf) {
-        texMagic = SDL_CreateTextureFromSurface(renderer, msurf);
+        texMagic = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, msurf), "Hud", ResourceTracker::SESSION);
         SDL_DestroySurface(msurf);
         if (texMagic) {
             SDL_SetTextureScaleMode(texMagic, SDL_SCALEMODE_NEAREST);
@@ -36,7 +41,7 @@ Hud::Hud(SDL_Renderer* renderer, const std::string& spritePath)
     // Try to load key icon
     SDL_Surface* ksurf = IMG_Load("Assets/Sprites/key.png");
     if (ksurf) {
-        texKey = SDL_CreateTextureFromSurface(renderer, ksurf);
+        texKey = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, ksurf), "Hud", ResourceTracker::SESSION);
         SDL_DestroySurface(ksurf);
         if (texKey) {
             SDL_SetTextureScaleMode(texKey, SDL_SCALEMODE_NEAREST);
@@ -49,51 +54,72 @@ Hud::Hud(SDL_Renderer* renderer, const std::string& spritePath)
 
 Hud::~Hud()
 {
-    if (tex) SDL_DestroyTexture(tex);
-    if (texMagic) SDL_DestroyTexture(texMagic);
-    if (texKey) SDL_DestroyTexture(texKey);
+    if (tex) ResourceTracker::destroyTexture(tex);
+    if (texMagic) ResourceTracker::destroyTexture(texMagic);
+    if (texKey) ResourceTracker::destroyTexture(texKey);
+    delete layer;
 }
 
-void Hud::draw(SDL_Renderer* renderer, float health, float maxHealth)
+int Hud::frameFor(float value, float maxValue) const
 {
-    if (!tex) return;
-
-    // Guard maxHealth
-    if (maxHealth <= 0.0f) maxHealth = 1.0f;
+    // Guard max
+    if (maxValue <= 0.0f) maxValue = 1.0f;
 
-    // Map health fraction [0..1] to frame index where 0 = full, frameCount-1 = empty
-    float frac = std::clamp(health / maxHealth, 0.0f, 1.0f);
-
-    // We want full health -> frame 0. empty -> frame (frameCount-1)
+    // Map fraction [0..1] to frame index where 0 = full, frameCount-1 = empty
+    float frac = std::clamp(value / maxValue, 0.0f, 1.0f);
     int frame = int((1.0f - frac) * (frameCount - 1) + 0.5f);
-    frame = std::clamp(frame, 0, frameCount - 1);
+    return std::clamp(frame, 0, frameCount - 1);
+}
 
-    SDL_FRect src{ float(frame * frameW), 0.0f, float(frameW), float(frameH) };
-    // Scale up 2x
-    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
-    SDL_FRect dst{ 4.0f, 4.0f, float(frameW) * 1.5f, float(frameH) * 1.5f };
+void Hud::draw(SDL_Renderer* renderer, float health, float maxHealth)
+{
+    if (!tex) return;
 
-    // Ensure texture color modulation is default
-    SDL_SetTextureColorMod(tex, 0xFF, 0xFF, 0xFF);
-    SDL_RenderTexture(renderer, tex, &src, &dst);
+    State s;
+    s.healthFrame = frameFor(health, maxHealth);
+    present(renderer, s);
 }
 
 void Hud::draw(SDL_Renderer* renderer, float health, float maxHealth, float magic, float maxMagic, bool hasKey)
 {
     if (!tex) return;
 
-    // Draw health using existing logic
-    draw(renderer, health, maxHealth);
+    State s;
+    s.healthFrame = frameFor(health, maxHealth);
+    s.magicFrame = frameFor(magic, maxMagic);
+    s.hasKey = hasKey;
+    present(renderer, s);
+}
+
+void Hud::present(SDL_Renderer* renderer, const State& s)
+{
+    // Re-composite only when a displayed frame or the key changes
+    if (!(s == shown)) layer->invalidate();
+    if (layer->isDirty()) {
+        if (!layer->begin(renderer)) {
+            compose(renderer, s);
+            return;
+        }
+        compose(renderer, s);
+        layer->end(renderer);
+        shown = s;
+    }
+    layer->draw(renderer, 0.0f, 0.0f);
+}
 
-    // Guard maxMagic
-    if (maxMagic <= 0.0f) maxMagic = 1.0f;
+void Hud::compose(SDL_Renderer* renderer, const State& st)
+{
+    SDL_FRect src{ float(st.healthFrame * frameW), 0.0f, float(frameW), float(frameH) };
+    // Scale up 1.5x
+    SDL_FRect dst{ 4.0f, 4.0f, float(frameW) * 1.5f, float(frameH) * 1.5f };
+
+    // Ensure texture color modulation is default
+    SDL_SetTextureColorMod(tex, 0xFF, 0xFF, 0xFF);
+    SDL_RenderTexture(renderer, tex, &src, &dst);
 
-    // Map magic fraction [0..1] to frame index where 0 = full, frameCount-1 = empty
-    float mfrac = std::clamp(magic / maxMagic, 0.0f, 1.0f);
-    int mframe = int((1.0f - mfrac) * (frameCount - 1) + 0.5f);
-    mframe = std::clamp(mframe, 0, frameCount - 1);
+    if (st.magicFrame < 0) return;
 
-    SDL_FRect msrc{ float(mframe * frameW), 0.0f, float(frameW), float(frameH) };
+    SDL_FRect msrc{ float(st.magicFrame * frameW), 0.0f, float(frameW), float(frameH) };
 
     float scale = 1.5f;
     float hw = float(frameW) * scale;
@@ -107,7 +133,7 @@ void Hud::draw(SDL_Renderer* renderer, float health, float maxHealth, float magi
     SDL_RenderTexture(renderer, use, &msrc, &mdst);
 
     // Draw key icon to the right of magic if player has key
-    if (hasKey) {
+    if (st.hasKey) {
         float kx = mdst.x + mdst.w + 4.0f; // small spacing
         float ky = mdst.y;
         float kw = hw;
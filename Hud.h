@@ -2,9 +2,11 @@
 #include <SDL3/SDL.h>
 #include <string>
 
+class UiLayer;
+
 class Hud {
 public:
-    Hud(SDL_Renderer* renderer, const std::string& spritePath);
+    Hud(SDL_Renderer* renderer, const std::string& spritePath, float viewScale = 1.0f);
     ~Hud();
 
     // Draw the heart in the top-left. health/maxHealth mapped to frames (0 = full, N-1 = empty)
@@ -14,6 +16,21 @@ public:
     void draw(SDL_Renderer* renderer, float health, float maxHealth, float magic, float maxMagic, bool hasKey = false);
 
 private:
+    // What the HUD currently shows; the cached layer is only redrawn when this changes
+    struct State {
+        int healthFrame = -1;
+        int magicFrame = -1; // -1 = magic not shown
+        bool hasKey = false;
+        bool operator==(const State& o) const { return healthFrame == o.healthFrame && magicFrame == o.magicFrame && hasKey == o.hasKey; }
+    };
+
+    int frameFor(float value, float maxValue) const;
+    void present(SDL_Renderer* renderer, const State& s);
+    void compose(SDL_Renderer* renderer, const State& s);
+
+    State shown;
+    UiLayer* layer = nullptr;
+
     SDL_Texture* tex = nullptr;
     SDL_Texture* texMagic = nullptr; // separate texture for magic sprite
     SDL_Texture* texKey = nullptr; // key icon texture
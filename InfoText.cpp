@@ -1,32 +1,26 @@
 #include "InfoText.h"
+#include "ResourceTracker.h"
 #include "Camera.h"
 #include "Player.h"
 #include "Map.h"
+#include "GlyphAtlas.h"
+#include "UiLayer.h"
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <iostream>
 
-InfoText::InfoText(SDL_Renderer* ren, const std::string& fontPath, int fsize)
-    : renderer(ren), fontSize(fsize)
+InfoText::InfoText(SDL_Renderer* ren, const std::string& fontPath, int fsize, float vscale)
+    : renderer(ren), fontSize(fsize), viewScale(vscale)
 {
     if (!renderer) return;
 
-    if (TTF_WasInit() == 0) {
-        if (TTF_Init() != 0) {
-            SDL_Log("InfoText: Failed to init TTF: %s", SDL_GetError());
-            initedTTF = false;
-        } else {
-            initedTTF = true;
-        }
-    } else {
-        initedTTF = true;
-    }
+    layer = new UiLayer(0.0f, 0.0f, viewScale);
 
-    if (initedTTF) {
-        font = TTF_OpenFont(fontPath.c_str(), fontSize);
-        if (!font) {
-            SDL_Log("InfoText: Failed to open font '%s': %s", fontPath.c_str(), SDL_GetError());
-        }
+    font = GlyphAtlas::get(renderer, fontPath, fontSize);
+    if (!font) {
+        SDL_Log("InfoText: Failed to open font '%s': %s", fontPath.c_str(), SDL_GetError());
     }
 }
 
@@ -37,95 +31,97 @@ void InfoText::updateAuto(int currentLevelID, float playerWorldX, const Map* map
 {
     if (!map) return;
 
-    // Hardcoded icon paths (keyboard vs controller)
-    const std::string KB_JUMP = ("Assets/Icons/jump_kb.png");
-    const std::string CONT_JUMP = "Assets/Icons/jump_cont.png";
-    const std::string KB_ATTACK = "Assets/Icons/attack_kb.png";
-    const std::string CONT_ATTACK = "Assets/Icons/attack_cont.png";
-    const std::string KB_SPECIAL = "Assets/Icons/special_kb.png";
-    const std::string CONT_SPECIAL = "Assets/Icons/special_cont.png";
-    const std::string KB_DODGE = "Assets/Icons/dodge_kb.png";
-    const std::string CONT_DODGE = "Assets/Icons/dodge_cont.png";
-    const std::string KB_UP = "Assets/Icons/up_kb.png";
-    const std::string CONT_UP = "Assets/Icons/up_cont.png";
-    const std::string KB_DOWN = "Assets/Icons/down_kb.png";
-    const std::string CONT_DOWN = "Assets/Icons/down_cont.png";
-    const std::string KB_LEFT = "Assets/Icons/left_kb.png";
-    const std::string CONT_LEFT = "Assets/Icons/left_cont.png";
-    const std::string KB_RIGHT = "Assets/Icons/right_kb.png";
-    const std::string CONT_RIGHT = "Assets/Icons/right_cont.png";
-
     // Choose which set to use depending on last used input device
     bool cont = lastInputIsController;
 
-    // Build per-level markup. Add cases here for any levels that require hints.
-    std::string markup;
-    // Ensure icons are loaded and set preferred sizes when necessary.
-    auto ensureLoad = [&](const std::string &path, int prefW = -1, int prefH = -1) {
-        if (icons.find(path) == icons.end()) {
-            loadIcon(path, path);
-        }
-        if (prefW > 0 && prefH > 0) {
-            setIconPreferredSize(path, prefW, prefH);
-        }
-    };
+    // The markup only depends on level and input device; rebuild it when either changes
+    if (currentLevelID != autoLevelID || cont != autoCont) {
+        autoLevelID = currentLevelID;
+        autoCont = cont;
+
+        // Hardcoded icon paths (keyboard vs controller)
+        const std::string KB_JUMP = ("Assets/Icons/jump_kb.png");
+        const std::string CONT_JUMP = "Assets/Icons/jump_cont.png";
+        const std::string KB_ATTACK = "Assets/Icons/attack_kb.png";
+        const std::string CONT_ATTACK = "Assets/Icons/attack_cont.png";
+        const std::string KB_SPECIAL = "Assets/Icons/special_kb.png";
+        const std::string CONT_SPECIAL = "Assets/Icons/special_cont.png";
+        const std::string KB_DODGE = "Assets/Icons/dodge_kb.png";
+        const std::string CONT_DODGE = "Assets/Icons/dodge_cont.png";
+        const std::string KB_UP = "Assets/Icons/up_kb.png";
+        const std::string CONT_UP = "Assets/Icons/up_cont.png";
+        const std::string KB_DOWN = "Assets/Icons/down_kb.png";
+        const std::string CONT_DOWN = "Assets/Icons/down_cont.png";
+        const std::string KB_LEFT = "Assets/Icons/left_kb.png";
+        const std::string CONT_LEFT = "Assets/Icons/left_cont.png";
+        const std::string KB_RIGHT = "Assets/Icons/right_kb.png";
+        const std::string CONT_RIGHT = "Assets/Icons/right_cont.png";
+
+        // Build per-level markup. Add cases here for any levels that require hints.
+        std::string& markup = autoMarkup;
+        // Ensure icons are loaded and set preferred sizes when necessary.
+        auto ensureLoad = [&](const std::string &path, int prefW = -1, int prefH = -1) {
+            if (icons.find(path) == icons.end()) {
+                loadIcon(path, path);
+            }
+            if (prefW > 0 && prefH > 0) {
+                setIconPreferredSize(path, prefW, prefH);
+            }
+        };
 
-    // Example: jump_kb is a 32x16 image and should be drawn at that size
-    ensureLoad(KB_JUMP, 32, 16);
-    // load controller jump icon at default size (defaults to 16x16)
-    ensureLoad(CONT_JUMP);
-    switch (currentLevelID) {
-    case 22:
-        markup = std::string("Press [img:") + (cont ? CONT_JUMP : KB_JUMP ) + "] to Jump";
-        break;
-    case 23:
-        markup = std::string("Press [img:") + (cont ? CONT_JUMP : KB_JUMP ) + "] Twice to Double Jump";
-        break;
-    case 24:
-        // example: attack hint (two icons inline)
-        markup = std::string("Press [img:") + (cont ? CONT_DOWN : KB_DOWN) + "]" + " + " + std::string("[img:") + (cont ? CONT_JUMP : KB_JUMP) + "] to Drop Down";
-        break;
-    case 25:
-        // directional hint
-        markup = std::string("Press [img:") + (cont ? CONT_ATTACK : KB_ATTACK) + "] to Attack";
-        break;
-    case 26:
-        // directional hint
-        markup = std::string("Watch out for Spikes!");
-        break;
-    case 27:
-        // directional hint
-        markup = std::string("Find Lamp Post to Save your Progress");
-        break;
-    case 28:
-        // directional hint
-        markup = std::string("Better Hurry!");
-        break;
-    case 32:
-        // directional hint
-        markup = std::string("[img:") + (cont ? CONT_UP : KB_UP) + "] To Enter";
-        break;
-    default:
-        // no automatic hint for this level
-        markup.clear();
-        break;
+        // Example: jump_kb is a 32x16 image and should be drawn at that size
+        ensureLoad(KB_JUMP, 32, 16);
+        // load controller jump icon at default size (defaults to 16x16)
+        ensureLoad(CONT_JUMP);
+        switch (currentLevelID) {
+        case 22:
+            markup = std::string("Press [img:") + (cont ? CONT_JUMP : KB_JUMP ) + "] to Jump";
+            break;
+        case 23:
+            markup = std::string("Press [img:") + (cont ? CONT_JUMP : KB_JUMP ) + "] Twice to Double Jump";
+            break;
+        case 24:
+            // example: attack hint (two icons inline)
+            markup = std::string("Press [img:") + (cont ? CONT_DOWN : KB_DOWN) + "]" + " + " + std::string("[img:") + (cont ? CONT_JUMP : KB_JUMP) + "] to Drop Down";
+            break;
+        case 25:
+            // directional hint
+            markup = std::string("Press [img:") + (cont ? CONT_ATTACK : KB_ATTACK) + "] to Attack";
+            break;
+        case 26:
+            // directional hint
+            markup = std::string("Watch out for Spikes!");
+            break;
+        case 27:
+            // directional hint
+            markup = std::string("Find Lamp Post to Save your Progress");
+            break;
+        case 28:
+            // directional hint
+            markup = std::string("Better Hurry!");
+            break;
+        case 32:
+            // directional hint
+            markup = std::string("[img:") + (cont ? CONT_UP : KB_UP) + "] To Enter";
+            break;
+        default:
+            // no automatic hint for this level
+            markup.clear();
+            break;
+        }
     }
 
-    // Delegate to the general update which finds trigger tiles and positions the text
-    update(markup, playerWorldX, map, showRange);
+    // Delegate to the general update which positions the text at the trigger tile
+    update(autoMarkup, playerWorldX, map, showRange);
 }
 
 InfoText::~InfoText()
 {
-    // free segment text textures
-    for (auto &s : segments) {
-        if (s.tex) SDL_DestroyTexture(s.tex);
-    }
     for (auto &p : icons) {
-        if (p.second) SDL_DestroyTexture(p.second);
+        if (p.second) ResourceTracker::destroyTexture(p.second);
     }
-    //if (font) TTF_CloseFont(font);
-    // Do not call TTF_Quit here; other code may use it
+    delete layer;
+    // font atlas is shared and released by the engine
 }
 
 bool InfoText::loadIcon(const std::string& id, const std::string& path)
@@ -136,7 +132,7 @@ bool InfoText::loadIcon(const std::string& id, const std::string& path)
         SDL_Log("InfoText: failed to load icon '%s' (%s)", path.c_str(), SDL_GetError());
         return false;
     }
-    SDL_Texture* t = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_Texture* t = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "InfoText icon", ResourceTracker::SESSION);
     SDL_free(surf);
     if (!t) {
         SDL_Log("InfoText: failed to create texture from '%s'", path.c_str());
@@ -150,15 +146,15 @@ bool InfoText::loadIcon(const std::string& id, const std::string& path)
     if (iconSizes.find(id) == iconSizes.end()) {
         iconSizes[id] = { 16, 16 };
     }
+    layoutDirty = true;
     return true;
 }
 
 void InfoText::clearSegments()
 {
-    for (auto &s : segments) {
-        if (s.tex) SDL_DestroyTexture(s.tex);
-    }
     segments.clear();
+    totalW = layoutW = layoutH = 0;
+    if (layer) layer->invalidate();
 }
 
 void InfoText::setMessage(const std::string& markup)
@@ -216,7 +212,7 @@ void InfoText::setMessage(const std::string& markup)
     if (!cur.empty()) {
         Segment seg; seg.type = SEG_TEXT; seg.text = cur; segments.push_back(seg);
     }
-    rebuildTextures();
+    layoutSegments();
 }
 
 void InfoText::setText(const std::string& markup)
@@ -244,26 +240,20 @@ void InfoText::setText(const std::string& markup)
     setMessage(out);
 }
 
-void InfoText::rebuildTextures()
+void InfoText::layoutSegments()
 {
-    if (!renderer || !initedTTF || !font) return;
+    layoutDirty = false;
+    if (!renderer || !font) {
+        // nothing can be measured: drop the message so no stale layout is drawn
+        segments.clear();
+        totalW = layoutW = layoutH = 0;
+        return;
+    }
     for (auto &s : segments) {
-            if (s.type == SEG_TEXT) {
-            if (s.tex) { SDL_DestroyTexture(s.tex); s.tex = nullptr; }
-            if (s.text.empty()) continue;
-            // render text to surface (use same API pattern as the rest of the project)
-            SDL_Surface* surf = TTF_RenderText_Solid(font, s.text.c_str(), 0, color);
-            if (!surf) continue;
-            s.w = surf->w;
-            s.h = surf->h;
-            s.tex = SDL_CreateTextureFromSurface(renderer, surf);
-            SDL_free(surf);
-            if (s.tex) {
-                SDL_SetTextureBlendMode(s.tex, SDL_BLENDMODE_BLEND);
-                SDL_SetTextureAlphaMod(s.tex, 255);
-                // ensure text textures are nearest scaled to keep pixel-art crisp
-                SDL_SetTextureScaleMode(s.tex, SDL_SCALEMODE_NEAREST);
-            }
+        if (s.type == SEG_TEXT) {
+            // text is drawn straight from the glyph atlas; only the extents are needed here
+            s.w = int(font->measure(s.text));
+            s.h = font->lineHeight();
         } else if (s.type == SEG_ICON) {
             if (s.icon) {
                 // query icon size (SDL_GetTextureSize uses floats in this codebase)
@@ -287,91 +277,103 @@ void InfoText::rebuildTextures()
             s.w = 0; s.h = 0;
         }
     }
+
+    // Measure the message once: total width (for centring, as before) and the
+    // bounding box of all lines including the 1px drop shadow
+    totalW = 0;
+    float x = 0.0f, y = 0.0f;
+    float maxX = 0.0f, maxY = 0.0f;
+    for (auto &s : segments) {
+        totalW += s.w;
+        if (s.type == SEG_NEWLINE) {
+            x = 0.0f;
+            y += float(fontSize) + 2.0f;
+            continue;
+        }
+        float sw = float(s.type == SEG_ICON && s.w <= 0 ? 16 : s.w);
+        float sh = float(s.type == SEG_ICON && s.h <= 0 ? 16 : s.h);
+        x += sw;
+        maxX = std::max(maxX, x + 1.0f);
+        maxY = std::max(maxY, y + sh + 1.0f);
+    }
+    layoutW = int(std::ceil(maxX));
+    layoutH = int(std::ceil(maxY));
+    if (layer) layer->resize(float(layoutW), float(layoutH));
 }
 
 // Note: old fade/update-by-distance removed. Visibility is controlled by active flag
 // which is set in update(markup, player, map).
 
 // New API: show/hide based on horizontal proximity to any trigger tile
+void InfoText::resolveTriggers(const Map* map)
+{
+    // Find a trigger tile and remember its tile position (first occurrence)
+    triggersResolved = true;
+    hasTrigger = false;
+    if (!map || map->width <= 0) return;
+    for (size_t i = 0; i < map->spawn.size(); ++i) {
+        if (map->spawn[i] == triggerTileId) {
+            triggerTx = int(i) % map->width;
+            triggerTy = int(i) / map->width;
+            hasTrigger = true;
+            break;
+        }
+    }
+}
+
 void InfoText::update(const std::string& markup, float playerWorldX, const Map* map, float showRange)
 {
-    // simple hide when empty
-    // Hide when empty or no map provided
+    // Hide when empty or no map provided. The cached layout is kept so showing the
+    // same message again does not rebuild anything.
     if (markup.empty() || !map) {
-        currentMarkup.clear();
-        clearSegments();
         active = false;
         currentAlpha = 0;
         return;
     }
 
-    // Find a trigger tile and compute its world position (first occurrence)
-    int foundIdx = -1;
-    for (size_t i = 0; i < map->spawn.size(); ++i) {
-        if (map->spawn[i] == triggerTileId) { foundIdx = int(i); break; }
-    }
-    if (foundIdx < 0) {
+    if (!triggersResolved) resolveTriggers(map);
+    if (!hasTrigger) {
         // no trigger present
-        currentMarkup.clear();
-        clearSegments();
         active = false; currentAlpha = 0; return;
     }
 
-    int ttx = foundIdx % map->width;
-    int tty = foundIdx / map->width;
-    float tileWorldX = float(ttx * Map::TILE_SIZE);
+    float tileWorldX = float(triggerTx * Map::TILE_SIZE);
 
     // Visibility is a simple horizontal proximity check (no fade)
     if (fabs(playerWorldX - tileWorldX) <= showRange) {
-        // Set the text (this builds textures and sets segment widths)
+        // Set the text (no-op while the markup is unchanged)
         setText(markup);
-        // compute total width of rendered segments
-        int totalW = 0;
-        for (auto &s : segments) totalW += s.w;
+        if (layoutDirty) layoutSegments();
         // Center the text horizontally on the spawn tile center
         float tileCenterX = tileWorldX + float(Map::TILE_SIZE) * 0.5f;
         posX = tileCenterX - float(totalW) * 0.5f;
-        posY = float(tty * Map::TILE_SIZE) - float(fontSize) - 2.0f;
+        posY = float(triggerTy * Map::TILE_SIZE) - float(fontSize) - 2.0f;
         setActive(true);
         currentAlpha = 255;
     } else {
-        setText("");
         setActive(false);
         currentAlpha = 0;
     }
 }
 
-void InfoText::draw(SDL_Renderer* ren, const Camera& cam)
+void InfoText::drawSegments(SDL_Renderer* ren, float x, float y, Uint8 alpha)
 {
-    if (!ren) return;
-    if (currentAlpha == 0) return;
-
-    // compute world -> screen
-    float sx = posX - cam.x;
-    float sy = posY - cam.y;
-
     // draw segments left to right
-    float x = sx;
-    float y = sy;
     float lineStartX = x;
     for (auto &s : segments) {
         if (s.type == SEG_TEXT) {
-            if (!s.tex) continue;
+            if (!font || s.text.empty()) continue;
             // render drop shadow first (offset by 1px)
-            SDL_SetTextureColorMod(s.tex, 0x00, 0x00, 0x00);
-            SDL_SetTextureAlphaMod(s.tex, (Uint8)(currentAlpha * 0.6f));
-            SDL_FRect sdst{ x + 1.0f, y + 1.0f, float(s.w), float(s.h) };
-            SDL_RenderTexture(ren, s.tex, nullptr, &sdst);
+            SDL_Color shadow{ 0x00, 0x00, 0x00, (Uint8)(alpha * 0.6f) };
+            font->draw(ren, s.text, x + 1.0f, y + 1.0f, shadow);
             // render main text
-            SDL_SetTextureColorMod(s.tex, 0xFF, 0xFF, 0xFF);
-            SDL_SetTextureAlphaMod(s.tex, currentAlpha);
-            SDL_FRect dst{ x, y, float(s.w), float(s.h) };
-            SDL_RenderTexture(ren, s.tex, nullptr, &dst);
+            SDL_Color main{ color.r, color.g, color.b, alpha };
+            font->draw(ren, s.text, x, y, main);
             x += s.w;
         } else if (s.type == SEG_ICON) {
             if (s.icon) {
                 SDL_SetTextureColorMod(s.icon, 0xFF, 0xFF, 0xFF);
-                SDL_SetTextureAlphaMod(s.icon, currentAlpha);
+                SDL_SetTextureAlphaMod(s.icon, alpha);
                 // draw using the segment's computed width/height (respects preferred sizes)
                 float dw = float(s.w > 0 ? s.w : 16);
                 float dh = float(s.h > 0 ? s.h : 16);
@@ -381,7 +383,7 @@ void InfoText::draw(SDL_Renderer* ren, const Camera& cam)
                 SDL_RenderTexture(ren, s.icon, nullptr, &dst);
             } else {
                 // draw placeholder
-                SDL_SetRenderDrawColor(ren, 255, 200, 0, currentAlpha);
+                SDL_SetRenderDrawColor(ren, 255, 200, 0, alpha);
                 SDL_FRect dst{ x, y, 16.0f, 16.0f };
                 SDL_RenderFillRect(ren, &dst);
             }
@@ -393,5 +395,27 @@ void InfoText::draw(SDL_Renderer* ren, const Camera& cam)
             y += float(fontSize) + 2.0f; // line height
         }
     }
+}
+
+void InfoText::draw(SDL_Renderer* ren, const Camera& cam)
+{
+    if (!ren) return;
+    if (currentAlpha == 0 || segments.empty()) return;
+
+    // compute world -> screen
+    float sx = posX - cam.x;
+    float sy = posY - cam.y;
+
+    // Composite the message (with its drop shadow) once; afterwards it is a single quad
+    if (layer && layer->isDirty()) {
+        if (!layer->begin(ren)) {
+            drawSegments(ren, sx, sy, currentAlpha);
+            return;
+        }
+        drawSegments(ren, 0.0f, 0.0f, 255);
+        layer->end(ren);
+    }
+    if (layer) layer->draw(ren, sx, sy, currentAlpha);
+    else drawSegments(ren, sx, sy, currentAlpha);
     // No fade behavior; alpha is managed by update()
 }
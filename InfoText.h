@@ -1,7 +1,6 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
-#include <SDL3_ttf/SDL_ttf.h>
 
 #include <string>
 #include <vector>
@@ -10,14 +9,18 @@
 class Camera;
 class Player;
 class Map;
+class GlyphAtlas;
+class UiLayer;
 
 // Draw informational text in world-space affected by camera.
 // - 16px font by default
 // - inline 16x16 icons referenced as {ID} in markup
 // - fades in as player approaches trigger rect
+// - the laid-out message (shadow, text and icons) is cached in a texture and only
+//   rebuilt when the markup or input device changes
 class InfoText {
 public:
-    InfoText(SDL_Renderer* renderer, const std::string& fontPath, int fontSize = 16);
+    InfoText(SDL_Renderer* renderer, const std::string& fontPath, int fontSize = 16, float viewScale = 1.0f);
     ~InfoText();
 
     // trigger rect/fade removed: visibility is controlled by spawn tile proximity
@@ -46,7 +49,11 @@ public:
     void setLastInputIsController(bool v) { lastInputIsController = v; }
 
     // Set which spawn tile id acts as trigger (default 5)
-    void setTriggerTileId(int id) { triggerTileId = id; }
+    void setTriggerTileId(int id) { triggerTileId = id; triggersResolved = false; }
+
+    // Locate the trigger tile in the map's spawn layer. Call once per level load;
+    // update() only resolves lazily if this has not been called.
+    void resolveTriggers(const Map* map);
 
     // Draw applying camera offset
     void draw(SDL_Renderer* renderer, const Camera& cam);
@@ -58,15 +65,16 @@ private:
         std::string text; // used if SEG_TEXT
         SDL_Texture* icon = nullptr; // used if SEG_ICON
         std::string iconId; // id used to look up icon metadata
-        SDL_Texture* tex = nullptr; // cached rendered text texture for SEG_TEXT
         int w = 0, h = 0;
     };
 
-    void rebuildTextures();
+    void layoutSegments();
     void clearSegments();
+    // Draw all segments (shadow + text + icons) with the message origin at (x, y)
+    void drawSegments(SDL_Renderer* ren, float x, float y, Uint8 alpha);
 
     SDL_Renderer* renderer = nullptr;
-    TTF_Font* font = nullptr;
+    GlyphAtlas* font = nullptr; // shared glyph atlas for fontPath/fontSize
     SDL_Color color{ 212, 216, 220 ,255};
     int fontSize = 16;
     const size_t wrapLen = 24; // wrap after approx 14 chars
@@ -80,7 +88,23 @@ private:
     std::string currentMarkup;
 
     Uint8 currentAlpha = 0;
-    bool initedTTF = false;
+
+    // Cached layout: total segment width (used for centring) and bounding size
+    int totalW = 0;
+    int layoutW = 0, layoutH = 0;
+    bool layoutDirty = false;
+    UiLayer* layer = nullptr;
+    float viewScale = 1.0f;
+
+    // Trigger position, resolved once per level
+    bool triggersResolved = false;
+    bool hasTrigger = false;
+    int triggerTx = 0, triggerTy = 0;
+
+    // updateAuto cache: markup is rebuilt only when level or input device changes
+    int autoLevelID = -1;
+    bool autoCont = false;
+    std::string autoMarkup;
     int triggerTileId = 5; // default trigger spawn tile id
     float showRange = 64.0f; // how close (in pixels) player must be to show text
 public:
@@ -91,5 +115,10 @@ private:
 
 public:
     // Optionally set a preferred draw size for a loaded icon (width, height)
-    void setIconPreferredSize(const std::string& id, int w, int h) { iconSizes[id] = {w,h}; }
+    void setIconPreferredSize(const std::string& id, int w, int h) {
+        auto it = iconSizes.find(id);
+        if (it != iconSizes.end() && it->second.first == w && it->second.second == h) return;
+        iconSizes[id] = {w,h};
+        layoutDirty = true;
+    }
 };
@@ -0,0 +1,69 @@
+#include "LevelArena.h"
+#include <algorithm>
+#include <cstdint>
+
+LevelArena::LevelArena(size_t blockSize_)
+    : blockSize(blockSize_)
+{
+}
+
+LevelArena::~LevelArena()
+{
+    reset();
+    for (Block& b : blocks) delete[] b.data;
+    blocks.clear();
+}
+
+// Offset of the first `align`-aligned address at or after b.data + b.used
+static size_t alignedOffset(const unsigned char* data, size_t used, size_t align)
+{
+    uintptr_t p = reinterpret_cast<uintptr_t>(data) + used;
+    p = (p + align - 1) & ~uintptr_t(align - 1);
+    return size_t(p - reinterpret_cast<uintptr_t>(data));
+}
+
+void* LevelArena::allocate(size_t size, size_t align)
+{
+    // try the current block, then any later (already rewound) ones
+    for (; current < (int)blocks.size(); ++current) {
+        Block& b = blocks[current];
+        size_t at = alignedOffset(b.data, b.used, align);
+        if (at + size <= b.size) {
+            b.used = at + size;
+            return b.data + at;
+        }
+    }
+
+    // out of room: add a block, oversized if this one allocation needs it
+    Block b;
+    b.size = std::max(blockSize, size + align);
+    b.data = new unsigned char[b.size];
+    size_t at = alignedOffset(b.data, 0, align);
+    b.used = at + size;
+    blocks.push_back(b);
+    current = (int)blocks.size() - 1;
+    return b.data + at;
+}
+
+void LevelArena::reset()
+{
+    // later objects may refer to earlier ones, so tear down newest first
+    for (auto it = dtors.rbegin(); it != dtors.rend(); ++it) it->destroy(it->obj);
+    dtors.clear();
+    for (Block& b : blocks) b.used = 0;
+    current = 0;
+}
+
+size_t LevelArena::bytesUsed() const
+{
+    size_t n = 0;
+    for (const Block& b : blocks) n += b.used;
+    return n;
+}
+
+size_t LevelArena::bytesReserved() const
+{
+    size_t n = 0;
+    for (const Block& b : blocks) n += b.size;
+    return n;
+}
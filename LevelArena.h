@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bump allocator for everything a level spawns (player, enemies, map objects and falling
+// traps). Objects are constructed in large blocks and never freed one by one: reset() runs
+// the recorded destructors in reverse order and rewinds the blocks, so a level change is one
+// pass instead of hundreds of deletes, and the blocks are reused by the next level.
+// Pointers handed out by make() must not be deleted.
+class LevelArena {
+public:
+    explicit LevelArena(size_t blockSize = 64 * 1024);
+    ~LevelArena();
+    LevelArena(const LevelArena&) = delete;
+    LevelArena& operator=(const LevelArena&) = delete;
+
+    // Construct a T in the arena; its destructor runs on reset()
+    template <class T, class... Args>
+    T* make(Args&&... args)
+    {
+        T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            dtors.push_back({ obj, [](void* p) { static_cast<T*>(p)->~T(); } });
+        return obj;
+    }
+
+    void* allocate(size_t size, size_t align);
+
+    // Destroy everything made since the last reset and keep the blocks for reuse
+    void reset();
+
+    size_t bytesUsed() const;
+    size_t bytesReserved() const;
+
+private:
+    struct Block {
+        unsigned char* data = nullptr;
+        size_t size = 0;
+        size_t used = 0;
+    };
+    struct Dtor {
+        void* obj;
+        void (*destroy)(void*);
+    };
+
+    size_t blockSize;
+    std::vector<Block> blocks;
+    int current = 0; // block new allocations are bumped from
+    std::vector<Dtor> dtors;
+};
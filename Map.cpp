@@ -1,11 +1,26 @@
 #include "Map.h"
+#include "ResourceTracker.h"
+#include "SpawnRegistry.h"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <cmath>
-#include "Engine.h"
+#include <algorithm>
+#include <limits>
+#include "Sweep.h"
+
+// Animated decoration tiles. Sprites taller than a tile are shifted up so their bottoms
+// sit on the spawn tile.
+static const Map::AnimatedTileDef kAnimatedTiles[] = {
+    { Map::SPAWN_WATER,          "Assets/Sprites/water.png",          16, 32, 4, 12, 0, -16, false },
+    { Map::SPAWN_WATERFALL,      "Assets/Sprites/waterfall.png",      16, 48, 4, 12, 0, -32, true  },
+    { Map::SPAWN_WATERFALL_LONG, "Assets/Sprites/waterfall_long.png", 16, 32, 4, 12, 0, -16, true  },
+    { Map::SPAWN_DUNGEON_WATER,  "Assets/Sprites/dungeon_water.png",  16, 48, 4, 12, 0, -32, false },
+    { Map::SPAWN_WATERFALL_DAY,  "Assets/Sprites/waterfall_day.png",  48, 64, 5, 12, 0,   0, false },
+};
+static constexpr int kAnimatedTileCount = int(sizeof(kAnimatedTiles) / sizeof(kAnimatedTiles[0]));
 
 Map::Map()
 {
@@ -14,9 +29,11 @@ Map::Map()
 
 bool Map::loadTileset(SDL_Renderer* renderer, const std::string& path)
 {
+    // every level loads its tileset again; drop the previous one first
+    unloadTileset();
     SDL_Surface* surf = IMG_Load(path.c_str());
     if (!surf) return false;
-    tilesetTexture = SDL_CreateTextureFromSurface(renderer, surf);
+    tilesetTexture = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Map tileset");
     SDL_DestroySurface(surf);   
     if (!tilesetTexture) return false;
 
@@ -35,6 +52,12 @@ bool Map::loadTileset(SDL_Renderer* renderer, const std::string& path)
     return true;
 }
 
+void Map::unloadTileset()
+{
+    if (tilesetTexture) ResourceTracker::destroyTexture(tilesetTexture);
+    tilesetTexture = nullptr;
+}
+
 void Map::draw(SDL_Renderer* renderer, int camX, int camY)
 {
     // --------------------------------------------------
@@ -126,28 +149,8 @@ std::vector<Map::ObjectSpawn> Map::getObjectSpawns() const
             if (t < 0)
                 continue;
 
-            // Include any spawn types you want the engine to instantiate
-            if (t == SPAWN_PLAYER ||
-                t == SPAWN_ORC ||
-                t == SPAWN_WATER ||
-                t == SPAWN_WATERFALL ||
-                t == SPAWN_WATERFALL_LONG ||
-                t == SPAWN_DUNGEON_WATER ||
-                t == SPAWN_WATERFALL_DAY ||
-                t == SPAWN_FALLINGTRAP ||
-                t == SPAWN_SPIKES ||    
-                t == SPAWN_SKELETON ||
-                t == SPAWN_SLIME ||
-                t == SPAWN_ARCHER ||
-                t == SPAWN_PRESSURE_PLATE ||
-                t == SPAWN_KEY ||
-                t == SPAWN_CRATE ||
-                t == SPAWN_ARROWTRAP_LEFT ||
-                t == SPAWN_ARROWTRAP_RIGHT ||
-                t == SPAWN_DOOR ||
-                t == SPAWN_CHECKPOINT ||
-                // falling platform spawn tiles (use numeric ids in spawn CSV)
-                (t >= 363 && t <= 366))
+            // the spawn registry decides which tiles become objects
+            if (SpawnRegistry::spawns(t))
             {
                 out.push_back({
                     x,   // tile X
@@ -162,34 +165,25 @@ std::vector<Map::ObjectSpawn> Map::getObjectSpawns() const
 }
 
 
-bool Map::isSolid(int tx, int ty)
+void Map::resetOccupancy()
 {
-    if (tx < 0 || ty < 0 || tx >= width || ty >= height)
-        return true;
+    occupancy.assign(size_t(width) * height, 0);
+}
 
-    // Treat falling-platform spawn tiles as solid so players can stand on them
-    if (!spawn.empty()) {
-        int s = spawn[ty * width + tx];
-        if (s >= 363 && s <= 366) return true;
-    }
-
-    // Use getCollision for consistent semantics
-    int c = getCollision(tx, ty);
-    // If any active map object occupies this tile and is marked solid, treat tile as solid
-    if (gEngine) {
-        for (auto* mo : gEngine->objects) {
-            if (!mo || !mo->active) continue;
-            if (!mo->isSolid()) continue;
-            SDL_FRect r = mo->getRect();
-            int moLeft = int(r.x / TILE_SIZE);
-            int moRight = int((r.x + r.w - 1) / TILE_SIZE);
-            int moTop = int(r.y / TILE_SIZE);
-            int moBottom = int((r.y + r.h - 1) / TILE_SIZE);
-            if (tx >= moLeft && tx <= moRight && ty >= moTop && ty <= moBottom)
-                return true;
+void Map::addOccupancy(int tx0, int ty0, int tx1, int ty1, int delta)
+{
+    if (occupancy.empty()) return;
+    tx0 = std::max(tx0, 0);
+    ty0 = std::max(ty0, 0);
+    tx1 = std::min(tx1, width - 1);
+    ty1 = std::min(ty1, height - 1);
+    for (int y = ty0; y <= ty1; ++y) {
+        for (int x = tx0; x <= tx1; ++x) {
+            unsigned char& c = occupancy[y * width + x];
+            if (delta > 0) { if (c < 255) ++c; }
+            else if (c > 0) --c;
         }
     }
-    return c != -1;
 }
 
 int Map::getCollision(int tx, int ty) const
@@ -197,6 +191,16 @@ int Map::getCollision(int tx, int ty) const
     if (tx < 0 || ty < 0 || tx >= width || ty >= height)
         return -1;
 
+    // Fast path: the bit rows already fold in the spawn-layer platforms
+    if (bitsValid()) {
+        size_t w = size_t(ty) * rowWords + (tx >> 6);
+        uint64_t bit = uint64_t(1) << (tx & 63);
+        if (oneWayRows[w] & bit) return COLL_ONEWAY;
+        if (!(solidRows[w] & bit)) return -1;
+        int c = collision.empty() ? tiles[ty * width + tx] : collision[ty * width + tx];
+        return (c != -1 && c != COLL_ONEWAY) ? c : 1;
+    }
+
     // If a spawn layer exists, treat falling-platform spawn tiles as solid regardless of collision layer
     if (!spawn.empty()) {
         int s = spawn[ty * width + tx];
@@ -214,6 +218,313 @@ int Map::getCollision(int tx, int ty) const
 
 
 
+Map::TileClass Map::classifyTile(int tx, int ty) const
+{
+    size_t i = size_t(ty) * width + tx;
+    // resting falling platforms live in the spawn layer and are solid
+    if (spawn.size() == size_t(width) * height) {
+        int s = spawn[i];
+        if (s >= 363 && s <= 366) return TILE_SOLID;
+    }
+    int c = -1;
+    if (!collision.empty()) { if (i < collision.size()) c = collision[i]; }
+    else if (i < tiles.size()) c = tiles[i];
+    if (c == -1) return TILE_EMPTY;
+    return c == COLL_ONEWAY ? TILE_ONEWAY : TILE_SOLID;
+}
+
+void Map::rebuildCollisionBits()
+{
+    rowWords = (width + 63) / 64;
+    colWords = (height + 63) / 64;
+    solidRows.assign(size_t(rowWords) * height, 0);
+    oneWayRows.assign(size_t(rowWords) * height, 0);
+    solidCols.assign(size_t(colWords) * width, 0);
+    for (int ty = 0; ty < height; ++ty)
+        for (int tx = 0; tx < width; ++tx)
+            refreshCollisionBit(tx, ty);
+}
+
+void Map::refreshCollisionBit(int tx, int ty)
+{
+    if (!bitsValid() || tx < 0 || ty < 0 || tx >= width || ty >= height) return;
+    TileClass c = classifyTile(tx, ty);
+    size_t rw = size_t(ty) * rowWords + (tx >> 6);
+    size_t cw = size_t(tx) * colWords + (ty >> 6);
+    uint64_t rbit = uint64_t(1) << (tx & 63);
+    uint64_t cbit = uint64_t(1) << (ty & 63);
+    if (c == TILE_SOLID) { solidRows[rw] |= rbit; solidCols[cw] |= cbit; }
+    else { solidRows[rw] &= ~rbit; solidCols[cw] &= ~cbit; }
+    if (c == TILE_ONEWAY) oneWayRows[rw] |= rbit;
+    else oneWayRows[rw] &= ~rbit;
+}
+
+void Map::setCollisionAt(int tx, int ty, int value)
+{
+    if (tx < 0 || ty < 0 || tx >= width || ty >= height) return;
+    if (collision.empty()) {
+        // creating the layer replaces the tile-layer fallback everywhere
+        collision.assign(size_t(width) * height, -1);
+        collision[ty * width + tx] = value;
+        rebuildCollisionBits();
+        return;
+    }
+    collision[ty * width + tx] = value;
+    refreshCollisionBit(tx, ty);
+}
+
+void Map::setSpawnAt(int tx, int ty, int value)
+{
+    if (tx < 0 || ty < 0 || tx >= width || ty >= height || spawn.empty()) return;
+    spawn[ty * width + tx] = value;
+    refreshCollisionBit(tx, ty);
+}
+
+// Any set bit of `line` (stride `words`) between bit a0 and a1 inclusive?
+static bool anyBitInSpan(const std::vector<uint64_t>& bits, int words, int line, int a0, int a1, int lineLen)
+{
+    if (a0 < 0) a0 = 0;
+    if (a1 > lineLen - 1) a1 = lineLen - 1;
+    if (a0 > a1 || bits.empty()) return false;
+
+    auto maskFrom = [](int b) { return ~uint64_t(0) << b; };
+    auto maskTo = [](int b) { return b >= 63 ? ~uint64_t(0) : (uint64_t(1) << (b + 1)) - 1; };
+
+    const uint64_t* row = bits.data() + size_t(line) * words;
+    int w0 = a0 >> 6, w1 = a1 >> 6;
+    if (w0 == w1) return (row[w0] & maskFrom(a0 & 63) & maskTo(a1 & 63)) != 0;
+    if (row[w0] & maskFrom(a0 & 63)) return true;
+    for (int w = w0 + 1; w < w1; ++w)
+        if (row[w]) return true;
+    return (row[w1] & maskTo(a1 & 63)) != 0;
+}
+
+bool Map::anySolidInRow(int ty, int tx0, int tx1) const
+{
+    if (ty < 0 || ty >= height || !bitsValid()) return false;
+    return anyBitInSpan(solidRows, rowWords, ty, tx0, tx1, width);
+}
+
+bool Map::anyOneWayInRow(int ty, int tx0, int tx1) const
+{
+    if (ty < 0 || ty >= height || !bitsValid()) return false;
+    return anyBitInSpan(oneWayRows, rowWords, ty, tx0, tx1, width);
+}
+
+bool Map::anySolidInColumn(int tx, int ty0, int ty1) const
+{
+    if (tx < 0 || tx >= width || !bitsValid()) return false;
+    return anyBitInSpan(solidCols, colWords, tx, ty0, ty1, height);
+}
+
+bool Map::sweepX(const SDL_FRect& box, float& dx) const
+{
+    if (dx == 0.0f) return false;
+    int ty0 = int(box.y / TILE_SIZE);
+    int ty1 = int((box.y + box.h - 1) / TILE_SIZE);
+
+    if (dx > 0.0f) {
+        float right = box.x + box.w;
+        int c0 = int((right - 1) / TILE_SIZE);
+        int c1 = int((right - 1 + dx) / TILE_SIZE);
+        // columns entered during the move; the destination column is always checked
+        for (int c = (c1 > c0 ? c0 + 1 : c0); c <= c1; ++c) {
+            if (anySolidInColumn(c, ty0, ty1)) {
+                dx = c * TILE_SIZE - right;
+                return true;
+            }
+        }
+    } else {
+        int c0 = int(box.x / TILE_SIZE);
+        int c1 = int((box.x + dx) / TILE_SIZE);
+        for (int c = (c1 < c0 ? c0 - 1 : c0); c >= c1; --c) {
+            if (anySolidInColumn(c, ty0, ty1)) {
+                dx = (c + 1) * TILE_SIZE - box.x;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool Map::sweepY(const SDL_FRect& box, float& dy, bool landOnOneWay) const
+{
+    if (dy == 0.0f) return false;
+    int tx0 = int(box.x / TILE_SIZE);
+    int tx1 = int((box.x + box.w - 1) / TILE_SIZE);
+
+    if (dy > 0.0f) {
+        float bottom = box.y + box.h;
+        int r0 = int((bottom - 1) / TILE_SIZE);
+        int r1 = int((bottom - 1 + dy) / TILE_SIZE);
+        for (int r = (r1 > r0 ? r0 + 1 : r0); r <= r1; ++r) {
+            bool stop = anySolidInRow(r, tx0, tx1);
+            // one-way platforms only catch a box whose bottom started above their top
+            if (!stop && landOnOneWay && bottom - 1 <= float(r * TILE_SIZE))
+                stop = anyOneWayInRow(r, tx0, tx1);
+            if (stop) {
+                dy = r * TILE_SIZE - bottom;
+                return true;
+            }
+        }
+    } else {
+        int r0 = int(box.y / TILE_SIZE);
+        int r1 = int((box.y + dy) / TILE_SIZE);
+        for (int r = (r1 < r0 ? r0 - 1 : r0); r >= r1; --r) {
+            if (anySolidInRow(r, tx0, tx1)) {
+                dy = (r + 1) * TILE_SIZE - box.y;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool Map::sweepBox(const SDL_FRect& box, float dx, float dy, bool oneWayWalls, float& t) const
+{
+    if (!bitsValid()) return false;
+    SDL_FRect b = sweptBounds(box, dx, dy);
+    int c0 = std::max(0, int(std::floor(b.x / TILE_SIZE)));
+    int c1 = std::min(width - 1, int(std::floor((b.x + b.w) / TILE_SIZE)));
+    int r0 = std::max(0, int(std::floor(b.y / TILE_SIZE)));
+    int r1 = std::min(height - 1, int(std::floor((b.y + b.h) / TILE_SIZE)));
+
+    bool hit = false;
+    t = 1.0f;
+    for (int r = r0; r <= r1; ++r) {
+        bool rowSolid = anySolidInRow(r, c0, c1);
+        bool rowOneWay = anyOneWayInRow(r, c0, c1);
+        // without oneWayWalls a one-way tile only blocks a downward move starting above it
+        if (rowOneWay && !oneWayWalls && !(dy > 0.0f && box.y + box.h <= float(r * TILE_SIZE)))
+            rowOneWay = false;
+        if (!rowSolid && !rowOneWay) continue;
+
+        for (int c = c0; c <= c1; ++c) {
+            bool blocks = (rowSolid && anySolidInRow(r, c, c)) || (rowOneWay && anyOneWayInRow(r, c, c));
+            if (!blocks) continue;
+            SDL_FRect tile{ float(c * TILE_SIZE), float(r * TILE_SIZE), float(TILE_SIZE), float(TILE_SIZE) };
+            float tt;
+            if (sweptAABB(box, dx, dy, tile, tt) && tt < t) {
+                t = tt;
+                hit = true;
+                if (t <= 0.0f) return true;
+            }
+        }
+    }
+    return hit;
+}
+
+bool Map::tileMatches(int tx, int ty, unsigned flags) const
+{
+    if (tx < 0 || ty < 0 || tx >= width || ty >= height)
+        return (flags & QUERY_OFFMAP) != 0;
+
+    size_t i = size_t(ty) * width + tx;
+    if ((flags & QUERY_OBJECT) && i < occupancy.size() && occupancy[i] != 0) return true;
+    if ((flags & QUERY_HAZARD) && i < spawn.size() && spawn[i] == SPAWN_SPIKES) return true;
+    if (!(flags & (QUERY_SOLID | QUERY_ONEWAY))) return false;
+
+    TileClass c;
+    if (bitsValid()) {
+        size_t w = size_t(ty) * rowWords + (tx >> 6);
+        uint64_t bit = uint64_t(1) << (tx & 63);
+        c = (solidRows[w] & bit) ? TILE_SOLID : (oneWayRows[w] & bit) ? TILE_ONEWAY : TILE_EMPTY;
+    } else {
+        c = classifyTile(tx, ty);
+    }
+    return ((flags & QUERY_SOLID) && c == TILE_SOLID) || ((flags & QUERY_ONEWAY) && c == TILE_ONEWAY);
+}
+
+bool Map::overlapTiles(int tx0, int ty0, int tx1, int ty1, unsigned flags) const
+{
+    if (tx0 > tx1 || ty0 > ty1) return false;
+    if ((flags & QUERY_OFFMAP) && (tx0 < 0 || ty0 < 0 || tx1 >= width || ty1 >= height)) return true;
+    tx0 = std::max(tx0, 0);
+    ty0 = std::max(ty0, 0);
+    tx1 = std::min(tx1, width - 1);
+    ty1 = std::min(ty1, height - 1);
+    if (tx0 > tx1 || ty0 > ty1) return false;
+
+    unsigned perTile = flags & (QUERY_OBJECT | QUERY_HAZARD);
+    if (bitsValid()) {
+        for (int ty = ty0; ty <= ty1; ++ty) {
+            if ((flags & QUERY_SOLID) && anySolidInRow(ty, tx0, tx1)) return true;
+            if ((flags & QUERY_ONEWAY) && anyOneWayInRow(ty, tx0, tx1)) return true;
+        }
+    } else {
+        perTile |= flags & (QUERY_SOLID | QUERY_ONEWAY);
+    }
+    if (!perTile) return false;
+    for (int ty = ty0; ty <= ty1; ++ty)
+        for (int tx = tx0; tx <= tx1; ++tx)
+            if (tileMatches(tx, ty, perTile)) return true;
+    return false;
+}
+
+bool Map::overlapBox(const SDL_FRect& box, unsigned flags) const
+{
+    if (box.w <= 0.0f || box.h <= 0.0f) return false;
+    // edges that only touch a tile do not overlap it
+    int tx0 = int(std::floor(box.x / TILE_SIZE));
+    int ty0 = int(std::floor(box.y / TILE_SIZE));
+    int tx1 = int(std::ceil((box.x + box.w) / TILE_SIZE)) - 1;
+    int ty1 = int(std::ceil((box.y + box.h) / TILE_SIZE)) - 1;
+    return overlapTiles(tx0, ty0, tx1, ty1, flags);
+}
+
+bool Map::raycast(float x0, float y0, float x1, float y1, unsigned flags, RayHit* hit) const
+{
+    int tx = int(std::floor(x0 / TILE_SIZE));
+    int ty = int(std::floor(y0 / TILE_SIZE));
+    int endX = int(std::floor(x1 / TILE_SIZE));
+    int endY = int(std::floor(y1 / TILE_SIZE));
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    int stepX = dx > 0.0f ? 1 : -1;
+    int stepY = dy > 0.0f ? 1 : -1;
+
+    // tMax: fraction of the segment until the next vertical/horizontal grid line;
+    // tDelta: fraction needed to cross one whole tile on that axis
+    const float inf = std::numeric_limits<float>::infinity();
+    float tDeltaX = dx != 0.0f ? TILE_SIZE / std::fabs(dx) : inf;
+    float tDeltaY = dy != 0.0f ? TILE_SIZE / std::fabs(dy) : inf;
+    float tMaxX = dx > 0.0f ? ((tx + 1) * TILE_SIZE - x0) / dx : dx < 0.0f ? (tx * TILE_SIZE - x0) / dx : inf;
+    float tMaxY = dy > 0.0f ? ((ty + 1) * TILE_SIZE - y0) / dy : dy < 0.0f ? (ty * TILE_SIZE - y0) / dy : inf;
+
+    // every step enters a new tile, so the walk ends on the target tile
+    for (int n = std::abs(endX - tx) + std::abs(endY - ty); n > 0; --n) {
+        float tEnter;
+        if (tMaxX < tMaxY) {
+            tx += stepX;
+            tEnter = tMaxX;
+            tMaxX += tDeltaX;
+        } else {
+            ty += stepY;
+            tEnter = tMaxY;
+            tMaxY += tDeltaY;
+        }
+        if (tileMatches(tx, ty, flags)) {
+            if (hit) {
+                hit->tx = tx;
+                hit->ty = ty;
+                hit->t = std::clamp(tEnter, 0.0f, 1.0f);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+int Map::firstFreeTile(int tx, int ty, int dir, int maxSteps, unsigned flags) const
+{
+    for (int d = 1; d <= maxSteps; ++d) {
+        int x = tx + dir * d;
+        if (x < 0 || x >= width) return -1;
+        if (!tileMatches(x, ty, flags)) return x;
+    }
+    return -1;
+}
+
 int Map::getTile(int x, int y) const {
     if (x < 0 || y < 0 || x >= width || y >= height)
         return -1;
@@ -232,6 +543,10 @@ bool Map::loadCSV(const std::string& path)
     tiles2.clear();
     width = 0;
     height = 0;
+    // drop the packed bits until the new layers are in
+    solidRows.clear();
+    oneWayRows.clear();
+    solidCols.clear();
 
     std::string line;
     while (std::getline(file, line)) {
@@ -254,6 +569,7 @@ bool Map::loadCSV(const std::string& path)
         height++;
     }
 
+    rebuildCollisionBits();
     return true;
 }
 
@@ -338,6 +654,7 @@ bool Map::loadSpawnCSV(const std::string& path)
     }
 
     SDL_Log("Loaded spawn CSV: %dx%d", width, height);
+    rebuildCollisionBits();
     return true;
 }
 
@@ -381,6 +698,7 @@ bool Map::loadColCSV(const std::string& path)
     }
 
     SDL_Log("Loaded Collision CSV: %dx%d", width, height);
+    rebuildCollisionBits();
     return true;
 }
 
@@ -434,4 +752,107 @@ void Map::drawForeground(SDL_Renderer* renderer, int camX, int camY)
             SDL_RenderTexture(renderer, tilesetTexture, &src, &dest);
         }
     }
-}
\ No newline at end of file
+}
+
+// --------------------------------------------------
+// Animated tiles
+// --------------------------------------------------
+
+int Map::findAnimatedTile(int tileId)
+{
+    for (int i = 0; i < kAnimatedTileCount; ++i)
+        if (kAnimatedTiles[i].tileId == tileId) return i;
+    return -1;
+}
+
+bool Map::loadAnimatedTiles(SDL_Renderer* renderer)
+{
+    if (!animTextures.empty()) return true;
+
+    bool ok = true;
+    animTextures.assign(kAnimatedTileCount, nullptr);
+    for (int i = 0; i < kAnimatedTileCount; ++i) {
+        SDL_Surface* surf = IMG_Load(kAnimatedTiles[i].sprite);
+        if (!surf) {
+            SDL_Log("Failed to load animated tile '%s': %s", kAnimatedTiles[i].sprite, SDL_GetError());
+            ok = false;
+            continue;
+        }
+        SDL_Texture* tex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Map animated tiles", ResourceTracker::SESSION);
+        SDL_DestroySurface(surf);
+        if (!tex) { ok = false; continue; }
+        SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        animTextures[i] = tex;
+    }
+    return ok;
+}
+
+void Map::unloadAnimatedTiles()
+{
+    for (auto* t : animTextures) if (t) ResourceTracker::destroyTexture(t);
+    animTextures.clear();
+    animInstances.clear();
+}
+
+void Map::collectAnimatedTiles()
+{
+    animInstances.clear();
+    if (spawn.empty()) return;
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int def = findAnimatedTile(spawn[y * width + x]);
+            if (def < 0) continue;
+            const AnimatedTileDef& d = kAnimatedTiles[def];
+            animInstances.push_back({ def, float(x * TILE_SIZE + d.offsetX), float(y * TILE_SIZE + d.offsetY) });
+        }
+    }
+    // group by sprite sheet so each sheet is one draw call
+    std::stable_sort(animInstances.begin(), animInstances.end(),
+        [](const AnimatedTileInstance& a, const AnimatedTileInstance& b) { return a.def < b.def; });
+}
+
+void Map::drawAnimatedTiles(SDL_Renderer* renderer, int camX, int camY, bool behind)
+{
+    if (animInstances.empty() || animTextures.empty()) return;
+
+    const SDL_FColor white{ 1.0f, 1.0f, 1.0f, 1.0f };
+    size_t i = 0;
+    while (i < animInstances.size()) {
+        int def = animInstances[i].def;
+        const AnimatedTileDef& d = kAnimatedTiles[def];
+        SDL_Texture* tex = animTextures[def];
+
+        // every instance of a sheet shows the same frame of the global clock
+        animVerts.clear();
+        animIndices.clear();
+        int frame = int((animClock / unsigned(d.speed)) % unsigned(d.frames));
+        float texW = 0.0f, texH = 0.0f;
+        if (tex) SDL_GetTextureSize(tex, &texW, &texH);
+        float u0 = texW > 0.0f ? float(frame * d.frameW) / texW : 0.0f;
+        float u1 = texW > 0.0f ? float((frame + 1) * d.frameW) / texW : 0.0f;
+        float v1 = texH > 0.0f ? float(d.frameH) / texH : 0.0f;
+
+        for (; i < animInstances.size() && animInstances[i].def == def; ++i) {
+            if (d.behind != behind || !tex) continue;
+            const AnimatedTileInstance& inst = animInstances[i];
+            float x0 = std::round(inst.x - camX);
+            float y0 = std::round(inst.y - camY);
+            float x1 = x0 + float(d.frameW);
+            float y1 = y0 + float(d.frameH);
+
+            int base = (int)animVerts.size();
+            animVerts.push_back({ { x0, y0 }, white, { u0, 0.0f } });
+            animVerts.push_back({ { x1, y0 }, white, { u1, 0.0f } });
+            animVerts.push_back({ { x1, y1 }, white, { u1, v1 } });
+            animVerts.push_back({ { x0, y1 }, white, { u0, v1 } });
+            animIndices.push_back(base + 0); animIndices.push_back(base + 1); animIndices.push_back(base + 2);
+            animIndices.push_back(base + 0); animIndices.push_back(base + 2); animIndices.push_back(base + 3);
+        }
+
+        if (!animVerts.empty()) {
+            SDL_RenderGeometry(renderer, tex, animVerts.data(), (int)animVerts.size(), animIndices.data(), (int)animIndices.size());
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -32,6 +33,62 @@ public:
     // This allows callers to implement special behaviors (one-way platforms).
     int getCollision(int tx, int ty) const;
 
+    // ---------------- Packed collision ----------------
+    // One bit per tile, 64 tiles per word, built from the collision/spawn/tile layers:
+    // "solid" blocks from every side (any collision value other than -1 / COLL_ONEWAY, and
+    // resting falling-platform spawn tiles 363..366), "one-way" only blocks from above.
+    // Out-of-bounds tiles are empty, matching getCollision().
+    // Rebuild after loading the layers; runtime edits must go through setCollisionAt/setSpawnAt.
+    void rebuildCollisionBits();
+    void setCollisionAt(int tx, int ty, int value);
+    void setSpawnAt(int tx, int ty, int value);
+
+    // Span queries (inclusive tile ranges), scanned a word at a time
+    bool anySolidInRow(int ty, int tx0, int tx1) const;
+    bool anyOneWayInRow(int ty, int tx0, int tx1) const;
+    bool anySolidInColumn(int tx, int ty0, int ty1) const;
+
+    // Swept movement against the tile grid, so moves longer than a tile cannot skip geometry.
+    // The axis sweeps clamp `d` to the distance the box can travel and return true if it was
+    // blocked. One-way tiles never block sideways; sweepY lands on them when moving down
+    // from above (`landOnOneWay` false lets the caller drop through).
+    bool sweepX(const SDL_FRect& box, float& dx) const;
+    bool sweepY(const SDL_FRect& box, float& dy, bool landOnOneWay = true) const;
+    // Free (diagonal) sweep for small fast movers like arrows. On a hit `t` is the fraction
+    // of the move completed (0 if the box starts inside a blocking tile). One-way tiles count
+    // as walls when `oneWayWalls` is set.
+    bool sweepBox(const SDL_FRect& box, float dx, float dy, bool oneWayWalls, float& t) const;
+
+    // ---------------- Tile queries ----------------
+    // What a query matches; combine with |. QUERY_BLOCKING is exactly what isSolid() reports.
+    enum QueryFlags : unsigned {
+        QUERY_SOLID = 1 << 0,   // walls/floors and resting falling platforms
+        QUERY_ONEWAY = 1 << 1,  // one-way platforms
+        QUERY_OBJECT = 1 << 2,  // solid map objects (occupancy layer)
+        QUERY_HAZARD = 1 << 3,  // spike tiles in the spawn layer
+        QUERY_OFFMAP = 1 << 4,  // tiles outside the map
+        QUERY_BLOCKING = QUERY_SOLID | QUERY_ONEWAY | QUERY_OBJECT | QUERY_OFFMAP
+    };
+    struct RayHit {
+        int tx = -1, ty = -1; // tile that stopped the ray
+        float t = 1.0f;       // fraction of the segment where the ray enters it
+    };
+
+    bool tileMatches(int tx, int ty, unsigned flags) const;
+    // Any matching tile in the inclusive tile range / under the world-space box?
+    // Solid and one-way tests scan the packed rows a word at a time.
+    bool overlapTiles(int tx0, int ty0, int tx1, int ty1, unsigned flags) const;
+    bool overlapBox(const SDL_FRect& box, unsigned flags) const;
+    // Walk each tile the segment crosses exactly once (Amanatides-Woo) and stop at the
+    // first match. The start tile is not tested.
+    bool raycast(float x0, float y0, float x1, float y1, unsigned flags, RayHit* hit = nullptr) const;
+    bool hasLineOfSight(float x0, float y0, float x1, float y1) const {
+        return !raycast(x0, y0, x1, y1, QUERY_BLOCKING);
+    }
+    // First tile along row ty, 1..maxSteps tiles from tx in direction dir (+1/-1), that
+    // matches none of `flags`; -1 if there is none before the map edge.
+    int firstFreeTile(int tx, int ty, int dir, int maxSteps, unsigned flags) const;
+
     // Spawn / object tile ids (map uses these tile values to indicate spawns)
     static constexpr int SPAWN_PLAYER = 15;        // player spawn
     static constexpr int SPAWN_ORC = 16;           // orc enemy spawn
@@ -52,6 +109,11 @@ public:
     static constexpr int SPAWN_CHECKPOINT = 440; // checkpoint spawn (custom)
     static constexpr int SPAWN_CRATE = 24; // crate spawn
     static constexpr int SPAWN_PRESSURE_PLATE = 12; // pressure plate spawn
+    // falling platforms: a left edge starts a run of middles that a right edge closes
+    static constexpr int SPAWN_PLATFORM_LEFT = 363;
+    static constexpr int SPAWN_PLATFORM_MID = 364;
+    static constexpr int SPAWN_PLATFORM_RIGHT = 365;
+    static constexpr int SPAWN_PLATFORM_SINGLE = 366;
 
     // Backwards-compatible aliases used elsewhere in the codebase
     static constexpr int TRAP_TILE = SPAWN_SPIKES;
@@ -79,12 +141,77 @@ public:
     // Draw foreground tile layer (Tile Layer 2) on top of entities
     void drawForeground(SDL_Renderer* renderer, int camX, int camY);
 
-    // Check if a tile is solid (-1 is passable; object tiles are passable)
-    bool isSolid(int tx, int ty);
+    // Check if a tile is solid (-1 is passable; object tiles are passable).
+    // Solid map objects are found through the occupancy layer, so this is a flat lookup.
+    bool isSolid(int tx, int ty) const { return tileMatches(tx, ty, QUERY_BLOCKING); }
+
+    // ---------------- Object occupancy ----------------
+    // Per-tile count of solid map objects (crates, closed doors, resting falling platforms)
+    // covering the tile. Objects add/remove their footprint via MapObject::syncOccupancy().
+    std::vector<unsigned char> occupancy;
+    // Size the occupancy layer to the map and clear it (call after loading a level)
+    void resetOccupancy();
+    // Add (delta > 0) or remove (delta < 0) a footprint given as an inclusive tile range
+    void addOccupancy(int tx0, int ty0, int tx1, int ty1, int delta);
+    bool isOccupied(int tx, int ty) const {
+        return tx >= 0 && ty >= 0 && tx < width && ty < height && !occupancy.empty()
+            && occupancy[ty * width + tx] != 0;
+    }
 
     // Load a tileset from an image (16x16 tiles)
     bool loadTileset(SDL_Renderer* renderer, const std::string& path);
+    void unloadTileset();
 
     // Return object spawn tiles (tile value, tile coordinates)
     std::vector<ObjectSpawn> getObjectSpawns() const;
+
+    // ---------------- Animated tiles ----------------
+    // Decorative spawn tiles (water, waterfalls) are not entities: they are looked up
+    // in a table keyed by spawn tile id, advanced by one global clock and drawn in
+    // one batch per sprite sheet.
+    struct AnimatedTileDef {
+        int tileId;          // spawn tile id
+        const char* sprite;  // horizontal strip of frames
+        int frameW, frameH;
+        int frames;
+        int speed;           // ticks per frame
+        int offsetX, offsetY; // pixel offset from the tile's top-left
+        bool behind;         // draw behind entities (otherwise on top of the tile layer)
+    };
+    // Returns the table index for a spawn tile id, or -1 if it is not animated
+    static int findAnimatedTile(int tileId);
+
+    // Load the animated tile sprite sheets (once; later calls are no-ops)
+    bool loadAnimatedTiles(SDL_Renderer* renderer);
+    void unloadAnimatedTiles();
+    // Rebuild the animated tile instance list from the spawn layer (once per level)
+    void collectAnimatedTiles();
+    // Advance the shared animation clock by one tick
+    void updateAnimations() { ++animClock; }
+    // Draw animated tiles of one depth group (behind entities or in front)
+    void drawAnimatedTiles(SDL_Renderer* renderer, int camX, int camY, bool behind);
+
+private:
+    enum TileClass { TILE_EMPTY = 0, TILE_SOLID = 1, TILE_ONEWAY = 2 };
+    // Classify a tile from the raw layers (the slow path the bit rows cache)
+    TileClass classifyTile(int tx, int ty) const;
+    void refreshCollisionBit(int tx, int ty);
+    bool bitsValid() const { return !solidRows.empty() && solidRows.size() == size_t(rowWords) * height; }
+
+    int rowWords = 0;                 // words per row of solidRows/oneWayRows
+    int colWords = 0;                 // words per column of solidCols
+    std::vector<uint64_t> solidRows;  // row-major solid bits
+    std::vector<uint64_t> oneWayRows; // row-major one-way bits
+    std::vector<uint64_t> solidCols;  // column-major copy of solidRows for vertical spans
+
+    struct AnimatedTileInstance {
+        int def;     // index into the animated tile table
+        float x, y;  // world position (offset applied)
+    };
+    std::vector<AnimatedTileInstance> animInstances; // grouped by def
+    std::vector<SDL_Texture*> animTextures;          // one per table entry
+    unsigned int animClock = 0;
+    // scratch buffers for batching
+    std::vector<SDL_Vertex> animVerts;
+    std::vector<int> animIndices;
 };
@@ -1,8 +1,15 @@
 #include "MapObject.h"
+#include "ResourceTracker.h"
 #include "GameObject.h"
 #include "AnimationManager.h"
+#include "Engine.h"
 #include <SDL3_image/SDL_image.h>
 #include <cmath>
+#include <utility>
+#include <vector>
+
+// path -> texture for the current level; failed loads are kept as nullptr so they log once
+static std::vector<std::pair<std::string, SDL_Texture*>> sLevelTextures;
 
 MapObject::MapObject(int tileX, int tileY, int tileIndex)
     : tx(tileX), ty(tileY), tileIndex(tileIndex)
@@ -15,10 +22,34 @@ MapObject::MapObject(int tileX, int tileY, int tileIndex)
     anim = nullptr;
 }
 
-MapObject::~MapObject()
+MapObject::~MapObject() = default;
+
+SDL_Texture* MapObject::levelTexture(SDL_Renderer* renderer, const std::string& path)
 {
-    if (anim) delete anim;
-    if (animTexture) SDL_DestroyTexture(animTexture);
+    for (auto& t : sLevelTextures)
+        if (t.first == path) return t.second;
+
+    SDL_Texture* tex = nullptr;
+    SDL_Surface* surf = renderer ? IMG_Load(path.c_str()) : nullptr;
+    if (surf) {
+        tex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "MapObject");
+        SDL_DestroySurface(surf);
+    }
+    if (tex) {
+        SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    } else {
+        SDL_Log("MapObject: failed to load sprite '%s': %s", path.c_str(), SDL_GetError());
+    }
+    sLevelTextures.emplace_back(path, tex);
+    return tex;
+}
+
+void MapObject::releaseLevelTextures()
+{
+    for (auto& t : sLevelTextures)
+        if (t.second) ResourceTracker::destroyTexture(t.second);
+    sLevelTextures.clear();
 }
 
 bool MapObject::loadAnimation(SDL_Renderer* renderer, const std::string& path,
@@ -26,17 +57,12 @@ bool MapObject::loadAnimation(SDL_Renderer* renderer, const std::string& path,
                        int innerX, int innerY, int innerW, int innerH,
                        int speed)
 {
-    SDL_Surface* surf = IMG_Load(path.c_str());
-    if (!surf) return false;
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_DestroySurface(surf);
-    if (!tex) return false;
-
-    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
-    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    SDL_Texture* tex = levelTexture(renderer, path);
+    if (!tex || !gEngine) return false;
 
     animTexture = tex;
-    anim = new AnimationManager(tex, frameW, frameH, frames, rowY, innerX, innerY, innerW ? innerW : frameW, innerH ? innerH : frameH);
+    anim = gEngine->levelArena.make<AnimationManager>(tex, frameW, frameH, frames, rowY, innerX, innerY, innerW ? innerW : frameW, innerH ? innerH : frameH);
+    anim->tracked.setOwner(tracked.owner());
     anim->setSpeed(speed);
     animFrameW = frameW;
     animFrameH = frameH;
@@ -54,6 +80,11 @@ void MapObject::update(GameObject& /*player*/, Map& /*map*/)
     if (anim) anim->update();
 }
 
+void MapObject::wake(int ticks)
+{
+    if (anim) anim->advance(ticks);
+}
+
 void MapObject::draw(SDL_Renderer* renderer, int camX, int camY, const Map& map) const
 {
     if (!active) return;
@@ -84,4 +115,24 @@ void MapObject::draw(SDL_Renderer* renderer, int camX, int camY, const Map& map)
 SDL_FRect MapObject::getRect()
 {
     return { x, y, float(w), float(h) };
+}
+
+void MapObject::syncOccupancy(Map& map)
+{
+    bool want = active && isSolid();
+    int l = 0, t = 0, r = -1, b = -1;
+    if (want) {
+        l = int(x / Map::TILE_SIZE);
+        t = int(y / Map::TILE_SIZE);
+        r = int((x + w - 1) / Map::TILE_SIZE);
+        b = int((y + h - 1) / Map::TILE_SIZE);
+    }
+    // nothing to do unless solidity or the covered tile range changed
+    if (want == occupying && (!want || (l == occL && t == occT && r == occR && b == occB)))
+        return;
+
+    if (occupying) map.addOccupancy(occL, occT, occR, occB, -1);
+    occupying = want;
+    occL = l; occT = t; occR = r; occB = b;
+    if (occupying) map.addOccupancy(occL, occT, occR, occB, +1);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include <SDL3/SDL.h>
 #include <string>
 #include "Map.h"
+#include "ResourceTracker.h"
+#include "SpatialHash.h"
 
 // forward
 class GameObject;
@@ -21,6 +23,11 @@ public:
                        int innerX = 0, int innerY = 0, int innerW = 0, int innerH = 0,
                        int speed = 12);
 
+    // Sprite sheets are loaded once per level and shared by every object drawn from the
+    // same file (a level's doors all use one door.png). Engine releases them on cleanup.
+    static SDL_Texture* levelTexture(SDL_Renderer* renderer, const std::string& path);
+    static void releaseLevelTextures();
+
     // Manually set object's pixel size (defaults to TILE_SIZE)
     void setSize(int width, int height) { w = width; h = height; }
 
@@ -32,16 +39,30 @@ public:
     int getHeight() const { return h; }
 
     SDL_FRect getRect();
+    // Area in which an actor can affect this object (or be affected by it). The engine only
+    // calls update() with enemies whose bounds touch this rect.
+    virtual SDL_FRect getInteractionRect() { return getRect(); }
     // If true, this object should be treated as a solid obstacle for pathing/collision
     virtual bool isSolid() const { return false; }
+    // Keep this object's footprint in the map occupancy layer in step with isSolid()/getRect().
+    // Call after anything that may move the object or change whether it is solid.
+    void syncOccupancy(Map& map);
     bool active = true;
 
+    // Activation: the engine stops updating objects far from the camera and counts the
+    // skipped ticks; wake() catches up on them when the object comes back in range.
+    int sleptTicks = 0;
+    virtual void wake(int ticks);
+    // True while the object must keep simulating out of range (pending triggers etc.)
+    virtual bool keepAwake() const { return false; }
+
     // If true, this object should be drawn behind the player even if it's taller than a tile.
     bool drawBehind = false;
 
     int getTileX() const { return tx; }
     int getTileY() const { return ty; }
     int getTileIndex() const { return tileIndex; }
+    SpatialHash::Kind getBroadphaseKind() const { return broadphaseKind; }
 
 protected:
     int tx, ty;
@@ -49,9 +70,21 @@ protected:
     float x, y;
     int w, h;
 
-    // Optional animation/texture for this map object
+    // Set by subclasses that collision code looks up by type: CRATE/DOOR entries in the
+    // broadphase are always a Crate/Door, whatever tile they were spawned from
+    SpatialHash::Kind broadphaseKind = SpatialHash::OBJECT;
+
+    // Optional animation/texture for this map object. The texture comes from levelTexture()
+    // and the animation from the level arena, so neither is freed by the object.
     SDL_Texture* animTexture = nullptr;
     AnimationManager* anim = nullptr;
     int animFrameW = 0;
     int animFrameH = 0;
+
+    // Tile range currently stamped into Map::occupancy (valid while `occupying`)
+    bool occupying = false;
+    int occL = 0, occT = 0, occR = -1, occB = -1;
+
+    // live-entity count for leak reports; subclasses name it after themselves
+    ResourceTracker::Token tracked{ ResourceTracker::ENTITY, "MapObject" };
 };
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include "Menu.h"
+#include "ResourceTracker.h"
 #include <SDL3/SDL.h>
-#include <SDL3_ttf/SDL_ttf.h>
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
 #include <cmath>
 #include "Sound.h"
+#include "GlyphAtlas.h"
+#include "UiLayer.h"
 
 Menu::Menu(SDL_Renderer* renderer, float viewScale_) : viewScale(viewScale_) {
     options.push_back("Play");
@@ -18,7 +20,7 @@ Menu::Menu(SDL_Renderer* renderer, float viewScale_) : viewScale(viewScale_) {
     // load background image
     SDL_Surface* surf = IMG_Load("Assets/Menu/Background.png");
     if (surf) {
-        bgTex = SDL_CreateTextureFromSurface(renderer, surf);
+        bgTex = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Menu", ResourceTracker::SESSION);
         if (bgTex) SDL_SetTextureScaleMode(bgTex, SDL_SCALEMODE_NEAREST);
         SDL_DestroySurface(surf);
     } else {
@@ -26,28 +28,26 @@ Menu::Menu(SDL_Renderer* renderer, float viewScale_) : viewScale(viewScale_) {
         bgTex = nullptr;
     }
 
-    if (!TTF_Init()) {
-        SDL_Log("TTF_Init failed: %s", SDL_GetError());
-        font = nullptr;
-        return;
-    }
-
-    font = TTF_OpenFont("Assets/Fonts/font.ttf", (float)fontSize);
+    font = GlyphAtlas::get(renderer, "Assets/Fonts/font.ttf", fontSize);
     if (!font) {
         SDL_Log("Failed to load font: %s", SDL_GetError());
     }
+
+    // menu covers the whole logical screen (in pre-scale draw units)
+    int lw = 320, lh = 240;
+    SDL_GetRenderLogicalPresentation(renderer, &lw, &lh, nullptr);
+    layer = new UiLayer(float(lw) / viewScale, float(lh) / viewScale, viewScale);
 }
 
 Menu::~Menu() {
-    if (font) {
-        TTF_CloseFont(font);
-        font = nullptr;
-    }
+    // font atlas is shared and released by the engine
+    font = nullptr;
+    delete layer;
+    layer = nullptr;
     if (bgTex) {
-        SDL_DestroyTexture(bgTex);
+        ResourceTracker::destroyTexture(bgTex);
         bgTex = nullptr;
     }
-    TTF_Quit();
 }
 
 void Menu::handleInput(const bool* keys) {
@@ -55,18 +55,8 @@ void Menu::handleInput(const bool* keys) {
     bool down = keys[SDL_SCANCODE_S] || keys[SDL_SCANCODE_DOWN];
     bool enter = keys[SDL_SCANCODE_RETURN] || keys[SDL_SCANCODE_SPACE];
 
-    if (up && !upLastKbd) {
-        if (state == State::Main)
-            selected = (selected - 1 + (int)options.size()) % (int)options.size();
-        else
-            selected = (selected - 1 + (int)optOptions.size()) % (int)optOptions.size();
-    }
-    if (down && !downLastKbd) {
-        if (state == State::Main)
-            selected = (selected + 1) % (int)options.size();
-        else
-            selected = (selected + 1) % (int)optOptions.size();
-    }
+    if (up && !upLastKbd) moveSelection(-1);
+    if (down && !downLastKbd) moveSelection(1);
     if (enter && !enterLastKbd) {
         activated = true;
     }
@@ -81,18 +71,8 @@ void Menu::handleInput(const Controller::State& cs) {
     bool down = cs.down;
     bool enter = cs.attack || cs.jump; // accept attack or jump as select
 
-    if (up && !upLastCtrl) {
-        if (state == State::Main)
-            selected = (selected - 1 + (int)options.size()) % (int)options.size();
-        else
-            selected = (selected - 1 + (int)optOptions.size()) % (int)optOptions.size();
-    }
-    if (down && !downLastCtrl) {
-        if (state == State::Main)
-            selected = (selected + 1) % (int)options.size();
-        else
-            selected = (selected + 1) % (int)optOptions.size();
-    }
+    if (up && !upLastCtrl) moveSelection(-1);
+    if (down && !downLastCtrl) moveSelection(1);
     if (enter && !enterLastCtrl) {
         activated = true;
     }
@@ -102,11 +82,57 @@ void Menu::handleInput(const Controller::State& cs) {
     enterLastCtrl = enter;
 }
 
+void Menu::moveSelection(int delta) {
+    int count = (int)((state == State::Main) ? options.size() : optOptions.size());
+    if (count <= 0) return;
+    selected = (selected + delta + count) % count;
+    invalidate();
+}
+
+void Menu::invalidate(bool relayout) {
+    if (relayout) layoutDirty = true;
+    if (layer) layer->invalidate();
+}
+
 void Menu::update() {
     // nothing for now
 }
 
-void Menu::render(SDL_Renderer* renderer) {
+void Menu::layoutItems() {
+    const auto& list = (state == State::Main) ? options : optOptions;
+
+    // UI layout uses inverse viewScale so items are smaller when engine scales up
+    float uiScale = 1.0f / viewScale;
+    float baseX = 60.0f * uiScale;
+    float baseY = 45.0f * uiScale;
+    float itemW = 200.0f * uiScale;
+    float itemH = 28.0f * uiScale;
+    float itemGap = 36.0f * uiScale;
+
+    items.clear();
+    for (size_t i = 0; i < list.size(); ++i) {
+        Item it;
+        it.label = list[i];
+        it.rect = { baseX, baseY + float(i) * itemGap, itemW, itemH };
+        if (font) {
+            float tw = font->measure(it.label);
+            float th = float(font->lineHeight());
+            // scale by integer factor to avoid fractional scaling blur
+            if (tw > 0 && th > 0) {
+                float sx = it.rect.w / tw;
+                float sy = it.rect.h / th;
+                float smin = std::floor(std::min(sx, sy));
+                it.textScale = std::max(1, (int)smin);
+            }
+            it.textX = it.rect.x + (it.rect.w - tw * it.textScale) * 0.5f;
+            it.textY = it.rect.y + (it.rect.h - th * it.textScale) * 0.5f;
+        }
+        items.push_back(it);
+    }
+    layoutDirty = false;
+}
+
+void Menu::compose(SDL_Renderer* renderer) {
     // Draw background or fallback color
     if (bgTex) {
         float w = 0, h = 0;
@@ -120,51 +146,36 @@ void Menu::render(SDL_Renderer* renderer) {
         SDL_RenderClear(renderer);
     }
 
-    const auto& list = (state == State::Main) ? options : optOptions;
-
-    // UI layout uses inverse viewScale so items are smaller when engine scales up
-    float uiScale = 1.0f / viewScale;
-    float baseX = 60.0f * uiScale;
-    float baseY = 45.0f * uiScale;
-    float itemW = 200.0f * uiScale;
-    float itemH = 28.0f * uiScale;
-    float itemGap = 36.0f * uiScale;
-
-    for (size_t i = 0; i < list.size(); ++i) {
-        SDL_FRect r{ baseX, baseY + float(i) * itemGap, itemW, itemH };
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    for (size_t i = 0; i < items.size(); ++i) {
+        const Item& it = items[i];
         if ((int)i == selected)
             SDL_SetRenderDrawColor(renderer, 200, 200, 80, 150);
         else
             SDL_SetRenderDrawColor(renderer, 160, 160, 160, 150);
-        SDL_RenderFillRect(renderer, &r);
+        SDL_RenderFillRect(renderer, &it.rect);
 
         if (font) {
             SDL_Color textColor = { 0, 0, 0, 255 };
-            // Use solid rendering for pixel fonts (no AA)
-            SDL_Surface* surf = TTF_RenderText_Solid(font, list[i].c_str(), 0, textColor);
-            if (surf) {
-                SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-                if (tex) {
-                    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
-                    float tw = 0, th = 0;
-                    SDL_GetTextureSize(tex, &tw, &th);
-                    // scale by integer factor to avoid fractional scaling blur
-                    int scale = 1;
-                    if (tw > 0 && th > 0) {
-                        float sx = r.w / tw;
-                        float sy = r.h / th;
-                        float smin = std::floor(std::min(sx, sy));
-                        scale = std::max(1, (int)smin);
-                    }
-                    SDL_FRect dst{ r.x + (r.w - tw*scale) * 0.5f, r.y + (r.h - th*scale) * 0.5f, tw * scale, th * scale };
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-                    SDL_RenderTexture(renderer, tex, nullptr, &dst);
-                    SDL_DestroyTexture(tex);
-                }
-                SDL_free(surf);
-            }
+            font->draw(renderer, it.label, it.textX, it.textY, textColor, float(it.textScale));
+        }
+    }
+}
+
+void Menu::render(SDL_Renderer* renderer) {
+    if (layoutDirty) layoutItems();
+
+    // Re-composite only when something changed; otherwise blit the cached menu
+    if (layer && layer->isDirty()) {
+        if (!layer->begin(renderer)) {
+            compose(renderer);
+            return;
         }
+        compose(renderer);
+        layer->end(renderer);
     }
+    if (layer) layer->draw(renderer, 0.0f, 0.0f);
+    else compose(renderer);
 }
 
 int Menu::consumeSelection() {
@@ -182,6 +193,7 @@ int Menu::consumeSelection() {
             // Options - enter options submenu
             state = State::Options;
             selected = 0;
+            invalidate(true);
             return -1;
         }
         else if (selected == 2) {
@@ -199,6 +211,7 @@ int Menu::consumeSelection() {
                 bool muted = gSound->isMusicMuted();
                 gSound->setMusicMuted(!muted);
                 optOptions[0] = std::string("Music: ") + (gSound->isMusicMuted() ? "Off" : "On");
+                invalidate(true);
             }
             return -1;
         }
@@ -206,6 +219,7 @@ int Menu::consumeSelection() {
             // Back to main menu
             state = State::Main;
             selected = 0;
+            invalidate(true);
             return -1;
         }
     }
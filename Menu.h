@@ -2,9 +2,11 @@
 #include <SDL3/SDL.h>
 #include <vector>
 #include <string>
-#include <SDL3_ttf/SDL_ttf.h>
 #include "Player.h" // for Controller::State
 
+class GlyphAtlas;
+class UiLayer;
+
 class Menu {
 public:
     Menu(SDL_Renderer* renderer, float viewScale = 1.0f);
@@ -21,6 +23,21 @@ public:
 private:
     enum class State { Main, Options } state = State::Main;
 
+    // Retained widgets: laid out once per list change, not every frame
+    struct Item {
+        std::string label;
+        SDL_FRect rect{ 0, 0, 0, 0 };
+        float textX = 0.0f, textY = 0.0f;
+        int textScale = 1;
+    };
+    std::vector<Item> items;
+    bool layoutDirty = true;
+
+    void layoutItems();
+    void compose(SDL_Renderer* renderer);
+    void moveSelection(int delta);
+    void invalidate(bool relayout = false);
+
     std::vector<std::string> options; // main menu
     std::vector<std::string> optOptions; // options menu
     int selected = 0;
@@ -35,8 +52,8 @@ private:
     bool downLastCtrl = false;
     bool enterLastCtrl = false;
 
-    // font
-    TTF_Font* font = nullptr;
+    // font (shared glyph atlas)
+    GlyphAtlas* font = nullptr;
     int fontSize = 14;
 
     // background image
@@ -44,4 +61,7 @@ private:
 
     // rendering scale (from engine view scale)
     float viewScale = 1.0f;
+
+    // cached composited menu; redrawn only when selection/state/labels change
+    UiLayer* layer = nullptr;
 };
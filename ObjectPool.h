@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Fixed-capacity object pool.
+// Storage for `capacity` objects is allocated once. acquire() constructs an object in a
+// slot taken from the free list and releaseAt() destroys it and returns the slot, so spawning
+// never touches the heap. Live objects are also kept in a dense list with swap-remove, so
+// iteration visits only live objects and removal never shifts the rest (order is not kept).
+template <class T>
+class ObjectPool {
+public:
+    explicit ObjectPool(int capacity)
+        : storage(new Slot[capacity]), cap(capacity)
+    {
+        freeList.reserve(capacity);
+        live.reserve(capacity);
+        for (int i = capacity - 1; i >= 0; --i) freeList.push_back(i);
+    }
+    ~ObjectPool()
+    {
+        clear();
+        delete[] storage;
+    }
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Construct a new object; returns nullptr when the pool is full
+    template <class... Args>
+    T* acquire(Args&&... args)
+    {
+        if (freeList.empty()) return nullptr;
+        int slot = freeList.back();
+        freeList.pop_back();
+        T* obj = new (&storage[slot]) T(std::forward<Args>(args)...);
+        live.push_back(obj);
+        return obj;
+    }
+
+    // Destroy the i-th live object; the last live object moves into its place
+    void releaseAt(int i)
+    {
+        T* obj = live[i];
+        obj->~T();
+        freeList.push_back(int(reinterpret_cast<Slot*>(obj) - storage));
+        live[i] = live.back();
+        live.pop_back();
+    }
+
+    void clear()
+    {
+        while (!live.empty()) releaseAt(int(live.size()) - 1);
+    }
+
+    int size() const { return (int)live.size(); }
+    bool empty() const { return live.empty(); }
+    int capacity() const { return cap; }
+    T* operator[](int i) const { return live[i]; }
+    typename std::vector<T*>::const_iterator begin() const { return live.begin(); }
+    typename std::vector<T*>::const_iterator end() const { return live.end(); }
+
+private:
+    struct Slot { alignas(T) unsigned char bytes[sizeof(T)]; };
+    Slot* storage = nullptr;
+    int cap = 0;
+    std::vector<int> freeList; // free slot indices
+    std::vector<T*> live;      // dense list of constructed objects
+};
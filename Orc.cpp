@@ -12,45 +12,55 @@ Orc::Orc(SDL_Renderer* renderer,
     bool block)
     : GameObject(renderer, spritePath, tw, th)
 {
-    obj.x = startX;
-    obj.y = startY;
-
-    obj.facing = true;
-    obj.velx = patrolSpeed;   // patrol speed
-    obj.avoidEdges = true;
-    obj.attSpeed = 4;
-    obj.damage = dam;
-	audio.hitSfx = "orc_hit";
-	audio.deathSfx = "orc_death";
+    tracked.setOwner("Orc");
+    obj->facing = true;
+    obj->velx = patrolSpeed;   // patrol speed
+    obj->avoidEdges = true;
+    stats.attSpeed = 4;
+    stats.damage = dam;
+	audio.hitSfx = Sfx::ORC_HIT;
+	audio.deathSfx = Sfx::ORC_DEATH;
 	canBlock = block;
 
+    spawnAt(startX, startY);
+}
+
+void Orc::spawnAt(float x, float y)
+{
+    obj->x = obj->prevX = x;
+    obj->y = obj->prevY = y;
+
+    // own stream: AI rolls don't depend on how many other orcs updated first
+    Uint64 hi = gRng.ai.next();
+    rng.reseed((hi << 32) | gRng.ai.next());
+
     // initialize random pause cooldown so they don't all pause at once
     // Start in a paused state so newly spawned orcs may begin idle
     paused = true;
-    pauseTimer = rand() % (PAUSE_MAX - PAUSE_MIN + 1) + PAUSE_MIN;
-    obj.velx = 0; // don't move while paused
+    pauseTimer = rng.range(PAUSE_MIN, PAUSE_MAX);
+    obj->velx = 0; // don't move while paused
     // set cooldown that will be used after this initial pause
-    pauseCooldown = rand() % (COOLDOWN_MAX - COOLDOWN_MIN + 1) + COOLDOWN_MIN;
+    pauseCooldown = rng.range(COOLDOWN_MIN, COOLDOWN_MAX);
 }
 
 void Orc::aiUpdate(Player& player, Map& map)
 {
-    if (!obj.alive) return;
+    if (!obj->alive) return;
     if (knockbackTimer > 0) {
         GameObject::update(map);
         // If knockback just ended during GameObject::update, orient to face the player
         if (knockbackTimer <= 0) {
-            obj.facing = (player.obj.x > obj.x);
+            obj->facing = (player.obj->x > obj->x);
         }
         return;
     }
 
-    float dist = player.obj.x - obj.x;
-    bool sameLevel = std::abs(player.obj.y - obj.y) < obj.tileHeight;
-    bool playerInFront = (dist > 0 && obj.facing) || (dist < 0 && !obj.facing);
+    float dist = player.obj->x - obj->x;
+    bool sameLevel = std::abs(player.obj->y - obj->y) < obj->tileHeight;
+    bool playerInFront = (dist > 0 && obj->facing) || (dist < 0 && !obj->facing);
 
     // Use the orc's attack hitbox width as the attack-start distance
-    float attackRange = float(obj.tileWidth) * 2.0f;
+    float attackRange = float(obj->tileWidth) * 2.0f;
     bool playerClose = std::abs(dist) <= attackRange;
 
     // Determine whether the orc can "see" the player for aggression purposes
@@ -67,13 +77,12 @@ void Orc::aiUpdate(Player& player, Map& map)
     // --------------------
     // Start attack
     // --------------------
-    if (sameLevel && playerClose && playerInFront && !obj.attacking && knockbackTimer <= 0 && !blocking) {
+    if (sameLevel && playerClose && playerInFront && !obj->attacking && knockbackTimer <= 0 && !blocking) {
         {
-            obj.attacking = true;
-            obj.attackTimer = obj.attSpeed * 5;
-            obj.velx = 0;
-            currentAnim = animAttack;
-            currentAnim->reset();
+            obj->attacking = true;
+            obj->attackTimer = Sint16(stats.attSpeed * 5);
+            obj->velx = 0;
+            anim.play(ClipSet::ATTACK);
             // Refresh aggressive timer when engaging the player
             hasSeenPlayer = true;
             aggressiveMode = true;
@@ -84,16 +93,16 @@ void Orc::aiUpdate(Player& player, Map& map)
     // --------------------
     // Random pause (idle) behaviour
     // --------------------
-    if (!obj.attacking && knockbackTimer <= 0 && !blocking) {
+    if (!obj->attacking && knockbackTimer <= 0 && !blocking) {
         if (pauseCooldown > 0) --pauseCooldown;
 
         if (paused) {
             // If player is close, interrupt pause and resume chasing
             if (sameLevel && std::abs(dist) < 80) {
                 paused = false;
-                obj.facing = (dist > 0);
+                obj->facing = (dist > 0);
                 // start moving using chase speed when resuming to chase
-                obj.velx = obj.facing ? chaseSpeed : -chaseSpeed;
+                obj->velx = obj->facing ? chaseSpeed : -chaseSpeed;
                 // mark aggressive
                 hasSeenPlayer = true;
                 aggressiveMode = true;
@@ -101,28 +110,28 @@ void Orc::aiUpdate(Player& player, Map& map)
             }
             else {
                 if (pauseTimer > 0) --pauseTimer;
-                obj.velx = 0;
+                obj->velx = 0;
                 if (pauseTimer <= 0) {
                     paused = false;
                     // Choose a random direction to resume moving
-                    bool faceRight = (rand() % 2) == 0;
-                    obj.facing = faceRight;
+                    bool faceRight = rng.range(0, 1) == 0;
+                    obj->facing = faceRight;
                     // if currently in aggressive mode use chaseSpeed, otherwise patrolSpeed
                     float useSpeed = aggressiveMode ? chaseSpeed : patrolSpeed;
-                    obj.velx = obj.facing ? useSpeed : -useSpeed;
+                    obj->velx = obj->facing ? useSpeed : -useSpeed;
                 }
             }
         }
         else {
             if (pauseCooldown <= 0) {
                 // small per-frame chance to enter a pause
-                if ((rand() % 100) < 3) {
+                if (rng.chance(3)) {
                     // Only enter a pause if player is not nearby
                     if (!(sameLevel && std::abs(dist) < 80)) {
                         paused = true;
-                        pauseTimer = rand() % (PAUSE_MAX - PAUSE_MIN + 1) + PAUSE_MIN;
-                        pauseCooldown = rand() % (COOLDOWN_MAX - COOLDOWN_MIN + 1) + COOLDOWN_MIN;
-                        obj.velx = 0;
+                        pauseTimer = rng.range(PAUSE_MIN, PAUSE_MAX);
+                        pauseCooldown = rng.range(COOLDOWN_MIN, COOLDOWN_MAX);
+                        obj->velx = 0;
                     } else {
                         // player is too close; delay next pause attempt
                         pauseCooldown = COOLDOWN_MIN;
@@ -135,12 +144,12 @@ void Orc::aiUpdate(Player& player, Map& map)
     // --------------------
     // Movement intent
     // --------------------
-    if (!obj.attacking && knockbackTimer <= 0 && !blocking) {
+    if (!obj->attacking && knockbackTimer <= 0 && !blocking) {
         if (!paused) {
             if (sameLevel && std::abs(dist) < 80 && playerInFront) {
                 // actively chase player using chaseSpeed
-                obj.velx = (dist < 0) ? -chaseSpeed : chaseSpeed;
-                obj.facing = obj.velx > 0;
+                obj->velx = (dist < 0) ? -chaseSpeed : chaseSpeed;
+                obj->facing = obj->velx > 0;
                 // entering chase refreshes aggressive timer
                 hasSeenPlayer = true;
                 aggressiveMode = true;
@@ -149,47 +158,45 @@ void Orc::aiUpdate(Player& player, Map& map)
             else {
                 // Patrol: use patrolSpeed unless in aggressive mode where we use chaseSpeed
                 float useSpeed = aggressiveMode ? chaseSpeed : patrolSpeed;
-                obj.velx = obj.facing ? useSpeed : -useSpeed;
+                obj->velx = obj->facing ? useSpeed : -useSpeed;
             }
         }
     }
-    else if (!obj.attacking && knockbackTimer > 0) {
+    else if (!obj->attacking && knockbackTimer > 0) {
         // While knocked back, keep facing consistent with velocity
-        obj.facing = obj.velx > 0;
+        obj->facing = obj->velx > 0;
     }
     else {
-        if (!blocking) obj.velx = 0;
+        if (!blocking) obj->velx = 0;
     }
 
     // --------------------
     // WALL + LEDGE CHECK (AI only)
     //   Do not let AI override knockback movement.
     // --------------------
-    if (!obj.attacking && knockbackTimer <= 0 && !blocking) {
-        float nextX = obj.x + obj.velx;
+    if (!obj->attacking && knockbackTimer <= 0 && !blocking) {
+        float nextX = obj->x + obj->velx;
 
         int l = int(nextX / map.TILE_SIZE);
-        int r = int((nextX + obj.tileWidth - 1) / map.TILE_SIZE);
-        int t = int(obj.y / map.TILE_SIZE);
-        int b = int((obj.y + obj.tileHeight - 1) / map.TILE_SIZE);
+        int r = int((nextX + obj->tileWidth - 1) / map.TILE_SIZE);
+        int t = int(obj->y / map.TILE_SIZE);
+        int b = int((obj->y + obj->tileHeight - 1) / map.TILE_SIZE);
 
         bool blocked = false;
 
-        // Wall
-        if (obj.velx > 0 && (map.isSolid(r, t) || map.isSolid(r, b)))
-            blocked = true;
-        if (obj.velx < 0 && (map.isSolid(l, t) || map.isSolid(l, b)))
+        // Wall (front column across the body's rows)
+        int frontX = obj->velx > 0 ? r : l;
+        if (obj->velx != 0 && map.overlapTiles(frontX, t, frontX, b, Map::QUERY_BLOCKING))
             blocked = true;
 
         // Ledge (tile in front & below)
-        int frontX = obj.velx > 0 ? r : l;
         int footY = b + 1;
         if (!map.isSolid(frontX, footY))
             blocked = true;
 
         if (blocked) {
-            obj.facing = !obj.facing;
-            obj.velx = 0; // let next frame pick direction
+            obj->facing = !obj->facing;
+            obj->velx = 0; // let next frame pick direction
         }
     }
 
@@ -210,46 +217,46 @@ void Orc::aiUpdate(Player& player, Map& map)
     // --------------------
     // Die if hit / Block if attacked from front
     // --------------------
-    if (player.obj.attacking) {
+    if (player.obj->attacking) {
         SDL_FRect atk = player.getAttackRect();
         SDL_FRect me = getRect();
 
         if (SDL_HasRectIntersectionFloat(&atk, &me)) {
-            float playerCenter = player.obj.x + player.obj.tileWidth * 0.5f;
-            float orcCenter = obj.x + obj.tileWidth * 0.5f;
-            bool attackFromFront = (playerCenter > orcCenter && obj.facing) || (playerCenter < orcCenter && !obj.facing);
+            float playerCenter = player.obj->x + player.obj->tileWidth * 0.5f;
+            float orcCenter = obj->x + obj->tileWidth * 0.5f;
+            bool attackFromFront = (playerCenter > orcCenter && obj->facing) || (playerCenter < orcCenter && !obj->facing);
 
             if (attackFromFront && canBlock) {
                 // Block the attack: enter blocking state and avoid taking damage
-			obj.velx = 0;
+			obj->velx = 0;
                 blocking = true;
                 blockTimer = BLOCK_DURATION;
                 // cancel any in-progress attack so hitbox/animation won't overlap
-                obj.attacking = false;
-                obj.attackTimer = 0;
+                obj->attacking = false;
+                obj->attackTimer = 0;
                 // stop horizontal movement immediately
-                obj.velx = 0;
-                if (animBlock) { currentAnim = animBlock; currentAnim->reset(); }
+                obj->velx = 0;
+                anim.play(ClipSet::BLOCK);
                 // optional: play block sfx if available
-                if (gSound) gSound->playSfx("hit", 128); // small feedback
-			player.obj.x -= (player.obj.facing) ? -0.1f : 0.1f; // slight pull to player
-			player.obj.attackTimer -= 1.0f; // slight delay to player's attack
-			gSound->playSfx("clang");
+                if (gSound) gSound->playSfx(Sfx::HIT, 128); // small feedback
+			player.obj->x -= (player.obj->facing) ? -0.1f : 0.1f; // slight pull to player
+			--player.obj->attackTimer; // slight delay to player's attack
+			gSound->playSfx(Sfx::CLANG);
             } else {
                 // Attacked from behind or side -> take damage normally
-                float playerCenter = player.obj.x + player.obj.tileWidth * 0.5f;
+                float playerCenter = player.obj->x + player.obj->tileWidth * 0.5f;
                 takeDamage(35.0f, playerCenter, 3, 6, 30, 2.5f, -4.0f);
-                obj.facing = player.obj.facing;
+                obj->facing = player.obj->facing;
             }
         }
     }
-    else if (obj.attacking) {
+    else if (obj->attacking) {
         SDL_FRect atk = getAttackRect();
         SDL_FRect me = player.getRect();
 
         if (SDL_HasRectIntersectionFloat(&atk, &me)) {
-            float orcCenter = obj.x + obj.tileWidth * 0.5f;
-            player.takeDamage(obj.damage, orcCenter, 3, 6, 30, 2.5f, -4.0f);
+            float orcCenter = obj->x + obj->tileWidth * 0.5f;
+            player.takeDamage(stats.damage, orcCenter, 3, 6, 30, 2.5f, -4.0f);
         }
     }
 
@@ -264,20 +271,36 @@ void Orc::aiUpdate(Player& player, Map& map)
     }
 }
 
+void Orc::wake(int ticks)
+{
+    GameObject::wake(ticks);
+    auto runDown = [ticks](int& t) { t = t > ticks ? t - ticks : 0; };
+    runDown(pauseCooldown);
+    runDown(pauseTimer); // a finished pause is picked up by the next aiUpdate
+    if (aggressiveMode) {
+        runDown(aggressiveTimer);
+        if (aggressiveTimer <= 0) aggressiveMode = false;
+    }
+    if (blockTimer > 0) {
+        runDown(blockTimer);
+        if (blockTimer <= 0) blocking = false;
+    }
+}
+
 SDL_FRect Orc::getAttackRect() const
 {
-    if (!obj.attacking)
+    if (!obj->attacking)
         return { 0,0,0,0 };
 
     // Wind-up: first half of attack has NO hitbox
-    if (obj.attackTimer > (obj.attSpeed * 3))
+    if (obj->attackTimer > (stats.attSpeed * 3))
         return { 0,0,0,0 };
 
     // Strike frames
-    float w = obj.tileWidth * 2;
+    float w = obj->tileWidth * 2;
     float h = 8;
-    float x = obj.facing ? obj.x + obj.tileWidth : obj.x - w;
-    float y = obj.y + 4;
+    float x = obj->facing ? obj->x + obj->tileWidth : obj->x - w;
+    float y = obj->y + 4;
 
     return { x, y, w, h };
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "GameObject.h"
 #include "Player.h"
+#include "Random.h"
 
 class Orc : public GameObject {
 public:
@@ -15,10 +16,14 @@ public:
 		bool block = false
     );
 
+    // Place this orc (usually a prototype clone) and roll its own patrol pauses
+    void spawnAt(float x, float y);
+
     float patrolSpeed = 0.5f;
     float chaseSpeed = 1.5f;
     void aiUpdate(Player& player, Map& map);
     SDL_FRect getAttackRect() const override;
+    void wake(int ticks) override;
     bool canBlock = false;
 
 private:
@@ -36,6 +41,7 @@ private:
     bool paused = false;            // whether currently paused
     int pauseTimer = 0;            // frames remaining in current pause
     int pauseCooldown = 0;         // frames until next possible pause
+    Rng rng;                       // this orc's own stream, seeded from gRng.ai at spawn
 
     // configuration (frames)
     const int PAUSE_MIN = 30;      // 0.5s at 60fps
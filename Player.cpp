@@ -35,9 +35,10 @@ Player::Player(SDL_Renderer* renderer,
     int th)
     : GameObject(renderer, spritePath, tw, th)
 {
+    tracked.setOwner("Player");
     // You can now safely access obj here
-    obj.x = 50;
-    obj.y = 100;
+    obj->x = 50;
+    obj->y = 100;
     jumpToken = 2;
 
     // buffer for allowing a quick tap of Down to be used with Jump
@@ -59,16 +60,16 @@ Player::Player(SDL_Renderer* renderer,
 }
 
 SDL_FRect Player::getAttackRect() const {
-    if (!obj.attacking)
+    if (!obj->attacking)
         return { 0,0,0,0 };
 
-    if (obj.attackTimer > (obj.attSpeed * 2))
+    if (obj->attackTimer > (stats.attSpeed * 2))
         return { 0,0,0,0 };
 
     float w = attackHitboxWidth;
     float h = 12.0f;
-    float x = obj.facing ? obj.x + obj.tileWidth : obj.x - w;
-    float y = obj.y + 4;
+    float x = obj->facing ? obj->x + obj->tileWidth : obj->x - w;
+    float y = obj->y + 4;
 
     return { x, y, w, h };
 }
@@ -76,7 +77,7 @@ SDL_FRect Player::getAttackRect() const {
 
 void Player::input(const bool* keys) {
     int attRand = Sound::randomInt(1, 3);
-    const char* attackSfx = (attRand == 1) ? "attack1" : (attRand == 2) ? "attack2" : "attack3";
+    SfxId attackSfx = (attRand == 1) ? Sfx::ATTACK1 : (attRand == 2) ? Sfx::ATTACK2 : Sfx::ATTACK3;
 
     if (knockbackTimer > 0) {
         return;
@@ -87,9 +88,9 @@ void Player::input(const bool* keys) {
     // detect rising edge so a single press triggers the charge sequence
     if (rawCharge && !chargePressedLastFrame) {
         // start charging immediately on press (no hold required)
-        if (!chargeCharging && !obj.attacking) {
-            if (obj.magic >= CHARGE_START_COST) {
-                obj.magic -= CHARGE_START_COST;
+        if (!chargeCharging && !obj->attacking) {
+            if (stats.magic >= CHARGE_START_COST) {
+                stats.magic -= CHARGE_START_COST;
                 chargeCharging = true;
                 chargeTimer = 0;
                 chargeFrame = 0;
@@ -97,9 +98,8 @@ void Player::input(const bool* keys) {
                 chargeMashPhase = 0;
                 chargeMashPhaseTick = 0;
                 chargeMashMagicTicks = 0;
-                currentAnim = animPlayerCharge;
-                if (currentAnim) currentAnim->reset();
-                if (gSound) gSound->playSfx("charge_start");
+                anim.play(ClipSet::PLAYERCHARGE);
+                if (gSound) gSound->playSfx(Sfx::CHARGE_START);
             } else {
                 SDL_Log("Player: not enough magic to start charge (%f required)", CHARGE_START_COST);
             }
@@ -120,39 +120,38 @@ void Player::input(const bool* keys) {
         // chargeCharging = false;
         // chargeTimer = 0;
         // chargeFrame = 0;
-        // if (!obj.attacking) currentAnim = animIdle;
+        // if (!obj->attacking) currentAnim = animIdle;
     }
 
     if (keys[SDL_SCANCODE_J]) {
-        if (!obj.attackKeyPressed && !obj.attacking) {
-            obj.attacking = true;      // start attack
-            obj.attackTimer = 5 * obj.attSpeed;  // 6 frames * 10 ticks per frame
-            currentAnim = animAttack;
-            currentAnim->reset();
+        if (!stats.attackKeyPressed && !obj->attacking) {
+            obj->attacking = true;      // start attack
+            obj->attackTimer = Sint16(5 * stats.attSpeed);  // 6 frames * 10 ticks per frame
+            anim.play(ClipSet::ATTACK);
             if (gSound) gSound->playSfx(attackSfx);
         }
-        obj.attackKeyPressed = true;
+        stats.attackKeyPressed = true;
     }
     else {
-        obj.attackKeyPressed = false;
+        stats.attackKeyPressed = false;
     }
 
     // Horizontal movement only if NOT attacking and NOT charging (unless dashing)
-    if (!obj.attacking && !chargeCharging && !chargeDashing) {
-        obj.velx = 0;
-        if (keys[SDL_SCANCODE_A]) { obj.velx = -2; obj.facing = false; }
-        if (keys[SDL_SCANCODE_D]) { obj.velx = 2; obj.facing = true; }
+    if (!obj->attacking && !chargeCharging && !chargeDashing) {
+        obj->velx = 0;
+        if (keys[SDL_SCANCODE_A]) { obj->velx = -2; obj->facing = false; }
+        if (keys[SDL_SCANCODE_D]) { obj->velx = 2; obj->facing = true; }
     }
     else if (!chargeDashing) {
-        obj.velx = 0;
+        obj->velx = 0;
     }
     
-    if (obj.onGround) {
+    if (obj->onGround) {
         jumpToken = 2;
         // jumpToken will be reset in update but keep here for parity
-        if (obj.velx != 0 && !obj.attacking) {
+        if (obj->velx != 0 && !obj->attacking) {
             // prevent rapid retriggering: no overlap, min interval 200ms
-            if (gSound) gSound->playSfx("step", 128, false, 100);
+            if (gSound) gSound->playSfx(Sfx::STEP, 128, false, 100);
         }
     }
 
@@ -183,7 +182,7 @@ void Player::input(const bool* keys) {
 // Controller input overload
 void Player::input(const Controller::State& cs) {
     int attRand = Sound::randomInt(1, 3);
-    const char* attackSfx = (attRand == 1) ? "attack1" : (attRand == 2) ? "attack2" : "attack3";
+    SfxId attackSfx = (attRand == 1) ? Sfx::ATTACK1 : (attRand == 2) ? Sfx::ATTACK2 : Sfx::ATTACK3;
 
     if (knockbackTimer > 0) {
         return;
@@ -191,16 +190,15 @@ void Player::input(const Controller::State& cs) {
 
     // Charged attack via controller: use attackChargedPressed edge
     if (cs.attackChargedPressed) {
-        if (!chargeCharging && !obj.attacking) {
-            if (obj.magic >= CHARGE_START_COST) {
-                obj.magic -= CHARGE_START_COST;
+        if (!chargeCharging && !obj->attacking) {
+            if (stats.magic >= CHARGE_START_COST) {
+                stats.magic -= CHARGE_START_COST;
                 chargeCharging = true;
                 chargeTimer = 0;
                 chargeFrame = 0;
                 chargeMashMagicTicks = 0;
-                currentAnim = animPlayerCharge;
-                if (currentAnim) currentAnim->reset();
-                if (gSound) gSound->playSfx("charge_start");
+                anim.play(ClipSet::PLAYERCHARGE);
+                if (gSound) gSound->playSfx(Sfx::CHARGE_START);
             } else {
                 SDL_Log("Player: not enough magic to start charge (%f required)", CHARGE_START_COST);
             }
@@ -215,31 +213,30 @@ void Player::input(const Controller::State& cs) {
 
     // Attack via controller
     if (cs.attack) {
-        if (!obj.attackKeyPressed && !obj.attacking) {
-            obj.attacking = true;
-            obj.attackTimer = 5 * obj.attSpeed;
-            currentAnim = animAttack;
-            currentAnim->reset();
+        if (!stats.attackKeyPressed && !obj->attacking) {
+            obj->attacking = true;
+            obj->attackTimer = Sint16(5 * stats.attSpeed);
+            anim.play(ClipSet::ATTACK);
             if (gSound) gSound->playSfx(attackSfx);
         }
-        obj.attackKeyPressed = true;
+        stats.attackKeyPressed = true;
     } else {
-        obj.attackKeyPressed = false;
+        stats.attackKeyPressed = false;
     }
 
     // Horizontal movement only if NOT attacking and NOT charging (unless dashing)
-    if (!obj.attacking && !chargeCharging && !chargeDashing) {
-        obj.velx = 0;
-        if (cs.left) { obj.velx = -2; obj.facing = false; }
-        if (cs.right) { obj.velx = 2; obj.facing = true; }
+    if (!obj->attacking && !chargeCharging && !chargeDashing) {
+        obj->velx = 0;
+        if (cs.left) { obj->velx = -2; obj->facing = false; }
+        if (cs.right) { obj->velx = 2; obj->facing = true; }
     } else if (!chargeDashing) {
-        obj.velx = 0;
+        obj->velx = 0;
     }
 
-    if (obj.onGround) {
+    if (obj->onGround) {
         // jumpToken reset handled in update
-        if (obj.velx != 0 && !obj.attacking) {
-            if (gSound) gSound->playSfx("step", 128, false, 100);
+        if (obj->velx != 0 && !obj->attacking) {
+            if (gSound) gSound->playSfx(Sfx::STEP, 128, false, 100);
         }
     }
 
@@ -267,64 +264,59 @@ void Player::input(const Controller::State& cs) {
 void Player::update(Map& map)
 {
     // Reset jumpToken and coyote when standing on ground
-    if (obj.onGround) {
+    if (obj->onGround) {
         jumpToken = 2;
         coyoteTimer = COYOTE_FRAMES;
     }
 
     // If jump was buffered and we are allowed to jump, perform jump now
-    if (jumpBufferTimer > 0 && jumpToken > 0 && !obj.attacking) {
+    if (jumpBufferTimer > 0 && jumpToken > 0 && !obj->attacking) {
         // Detect whether there's a one-way platform under the player's feet even
-        // if obj.onGround might be false due to minor float differences. This makes
+        // if obj->onGround might be false due to minor float differences. This makes
         // drop-through more forgiving when the player is effectively standing on
         // a one-way tile.
-        int leftTile = int(obj.x / map.TILE_SIZE);
-        int rightTile = int((obj.x + obj.tileWidth - 1) / map.TILE_SIZE);
-        int footTile = int((obj.y + obj.tileHeight) / map.TILE_SIZE);
-
-        bool oneWayBelow = false;
-        int colL = map.getCollision(leftTile, footTile);
-        int colR = map.getCollision(rightTile, footTile);
-        if (colL == Map::COLL_ONEWAY || colR == Map::COLL_ONEWAY) {
-            oneWayBelow = true;
-        }
+        int leftTile = int(obj->x / map.TILE_SIZE);
+        int rightTile = int((obj->x + obj->tileWidth - 1) / map.TILE_SIZE);
+        int footTile = int((obj->y + obj->tileHeight) / map.TILE_SIZE);
+
+        bool oneWayBelow = map.anyOneWayInRow(footTile, leftTile, rightTile);
 
         // If player intends to drop through platforms (either holding down or used the tap buffer)
         // and there's a one-way tile beneath their feet (or they are onGround), trigger drop-through.
-        if ((downHeld || downPressBufferTimer > 0) && (obj.onGround || oneWayBelow)) {
-            obj.ignoreOneWayTimer = 12; // drop-through window
+        if ((downHeld || downPressBufferTimer > 0) && (obj->onGround || oneWayBelow)) {
+            obj->ignoreOneWayTimer = 12; // drop-through window
             jumpBufferTimer = 0;
             // Ensure we actually start falling so the one-way collision check
             // won't immediately re-assert the ground. Clear onGround and give
             // a small downward nudge to begin falling through the platform.
-            obj.onGround = false;
-            obj.vely = 1.0f;
+            obj->onGround = false;
+            obj->vely = 1.0f;
         }
         // Ground (or coyote) jump: perform full jump
-        else if (obj.onGround || coyoteTimer > 0) {
-            obj.vely = -jumpHeight;
-            obj.onGround = false;
+        else if (obj->onGround || coyoteTimer > 0) {
+            obj->vely = -jumpHeight;
+            obj->onGround = false;
             jumpToken--;
             jumpBufferTimer = 0;
             if (jumpToken == 1) {
-                if (gSound) gSound->playSfx("jump2");
+                if (gSound) gSound->playSfx(Sfx::JUMP2);
             } else {
-                if (gSound) gSound->playSfx("jump1");
+                if (gSound) gSound->playSfx(Sfx::JUMP1);
             }
         }
         // Mid-air double-jump: compute correct impulse that accounts for gravity
-        else if (!obj.onGround && jumpToken > 0) {
+        else if (!obj->onGround && jumpToken > 0) {
             float pct = doubleJumpPercent;
             if (pct < 0.0f) pct = 0.0f;
             if (pct > 1.0f) pct = 1.0f;
             // desired initial velocity magnitude ~ sqrt(percent) * primary velocity
             float djVel = -std::sqrt(pct) * jumpHeight;
             // If currently moving upwards faster than djVel, keep the stronger upward velocity.
-            obj.vely = std::min(obj.vely, djVel);
-            obj.onGround = false;
+            obj->vely = std::min(obj->vely, djVel);
+            obj->onGround = false;
             jumpToken--;
             jumpBufferTimer = 0;
-            if (gSound) gSound->playSfx("jump2");
+            if (gSound) gSound->playSfx(Sfx::JUMP2);
         }
     }
 
@@ -333,7 +325,7 @@ void Player::update(Map& map)
         ++chargeTimer;
         // small forward movement during wind-up before mash window
         if (!chargeMashMode) {
-            obj.velx = obj.facing ? CHARGE_PREMOVE_SPEED : -CHARGE_PREMOVE_SPEED;
+            obj->velx = obj->facing ? CHARGE_PREMOVE_SPEED : -CHARGE_PREMOVE_SPEED;
         }
 
         // compute current frame index based on ticks
@@ -343,19 +335,19 @@ void Player::update(Map& map)
             // when we reach the CHARGE_FRAMES perform the dash (6th frame)
             if (chargeFrame + 1 == CHARGE_FRAMES) {
                 // perform dash now: set attacking state and dash velocity
-                obj.attacking = true;
-                obj.attackTimer = obj.attSpeed * 2;
-                obj.velx = (obj.facing ? CHARGE_DASH_SPEED : -CHARGE_DASH_SPEED);
+                obj->attacking = true;
+                obj->attackTimer = Sint16(stats.attSpeed * 2);
+                obj->velx = (obj->facing ? CHARGE_DASH_SPEED : -CHARGE_DASH_SPEED);
                 chargeDashing = true;
                 chargeDashTimer = int(CHARGE_DASH_DURATION);
                 chargeDashed = true; // mark that dash occurred during the animation
-                if (gSound) gSound->playSfx("charge_dash");
+                if (gSound) gSound->playSfx(Sfx::CHARGE_DASH);
             }
         }
     }
 
     // If dash occurred and the charge animation has reached its final frame, open the mash window
-    if (chargeDashed && !chargeMashMode && animPlayerCharge && animPlayerCharge->currentFrame == animPlayerCharge->frameCount - 1) {
+    if (chargeDashed && !chargeMashMode && anim.clip == ClipSet::PLAYERCHARGE && anim.frame == clipFrames(ClipSet::PLAYERCHARGE) - 1) {
         chargeMashMode = true;
         chargeMashTimer = CHARGE_MASH_MAX_TICKS;
         chargeMashPhase = 0;
@@ -372,23 +364,23 @@ void Player::update(Map& map)
             chargeTimer = 0;
             chargeFrame = 0;
             chargeMashMode = false;
-            if (currentAnim == animPlayerCharge) {
-                currentAnim = animIdle;
-                currentAnim->setSpeed(10);
+            if (anim.clip == ClipSet::PLAYERCHARGE) {
+                anim.set(ClipSet::IDLE);
+                anim.speed = 10;
             }
         }
     }
 
     // Mash-extension handling: while in mash mode, repeat last 7 frames when key is pressed; otherwise timeout -> nothing
-    if (chargeMashMode && !chargeDashing && animPlayerCharge) {
-         int totalFrames = animPlayerCharge->frameCount;
+    if (chargeMashMode && !chargeDashing && clips) {
+         int totalFrames = clipFrames(ClipSet::PLAYERCHARGE);
          int last7Start = std::max(0, totalFrames - 7);
 
          if (chargeAttackKeyPressed) {
                      // reset mash timer to keep extending while player continues to press/mash
                      chargeMashTimer = CHARGE_MASH_MAX_TICKS;
                      // hold position
-                     obj.velx = 0;
+                     obj->velx = 0;
  
                      // advance mash frame timing
                      ++chargeMashPhaseTick;
@@ -397,15 +389,17 @@ void Player::update(Map& map)
                          chargeMashPhase = (chargeMashPhase + 1) % 7;
                      }
  
-                     animPlayerCharge->currentFrame = last7Start + chargeMashPhase;
-                     animPlayerCharge->timer = 0;
+                     if (anim.clip == ClipSet::PLAYERCHARGE) {
+                         anim.frame = Uint8(last7Start + chargeMashPhase);
+                         anim.timer = 0;
+                     }
 
                     // Drain magic over time while mashing: 10 magic per second
                     ++chargeMashMagicTicks;
                     if (chargeMashMagicTicks >= TICKS_PER_SECOND) {
                         chargeMashMagicTicks = 0;
-                        if (obj.magic >= CHARGE_MASH_COST_PER_SECOND) {
-                            obj.magic -= CHARGE_MASH_COST_PER_SECOND;
+                        if (stats.magic >= CHARGE_MASH_COST_PER_SECOND) {
+                            stats.magic -= CHARGE_MASH_COST_PER_SECOND;
                         } else {
                             // Not enough magic to continue mashing: end mash mode
                             chargeMashMode = false;
@@ -413,9 +407,9 @@ void Player::update(Map& map)
                             chargeDashed = false;
                             chargeTimer = 0;
                             chargeFrame = 0;
-                            if (currentAnim == animPlayerCharge) {
-                                currentAnim = animIdle;
-                                currentAnim->setSpeed(10);
+                            if (anim.clip == ClipSet::PLAYERCHARGE) {
+                                anim.set(ClipSet::IDLE);
+                                anim.speed = 10;
                             }
                             chargeAttackKeyPressed = false;
                             chargeMashMagicTicks = 0;
@@ -424,30 +418,23 @@ void Player::update(Map& map)
 
                     // Deal damage each mash cycle to any enemies in front
                     // Use the same rect as the debug hitbox so it matches what is shown
-                    float atkW = float(obj.tileWidth) * 2.0f;
+                    float atkW = float(obj->tileWidth) * 2.0f;
                     float atkH = 8.0f;
-                    float atkX = obj.facing ? obj.x + obj.tileWidth : obj.x - atkW;
-                    float atkY = obj.y + 4.0f;
+                    float atkX = obj->facing ? obj->x + obj->tileWidth : obj->x - atkW;
+                    float atkY = obj->y + 4.0f;
                     SDL_FRect atk = { atkX, atkY, atkW, atkH };
 
-                    // Check orcs
-                    for (auto* e : gEngine->orc) {
-                        if (!e || !e->obj.alive) continue;
+                    // Check orcs and archers near the hitbox
+                    gEngine->broadphase.query(atk, SpatialHash::ENEMY, gEngine->nearby);
+                    for (auto* n : gEngine->nearby) {
+                        GameObject* e = n->actor;
+                        if (!e->obj->alive) continue;
                         SDL_FRect er = e->getRect();
                         if (SDL_HasRectIntersectionFloat(&atk, &er)) {
                             float atkCenter = atk.x + atk.w * 0.5f;
                             e->takeDamage(baseDamage, atkCenter, 3, 6, 30, 2.5f, -4.0f);
                         }
                     }
-                    // Check archers
-                    for (auto* a : gEngine->archers) {
-                        if (!a || !a->obj.alive) continue;
-                        SDL_FRect ar = a->getRect();
-                        if (SDL_HasRectIntersectionFloat(&atk, &ar)) {
-                            float atkCenter = atk.x + atk.w * 0.5f;
-                            a->takeDamage(baseDamage, atkCenter, 3, 6, 30, 2.5f, -4.0f);
-                        }
-                    }
                  } else {
             // not pressing: count down; when expires, end mash mode and clear state
             if (chargeMashTimer > 0) --chargeMashTimer;
@@ -458,9 +445,9 @@ void Player::update(Map& map)
                 chargeTimer = 0;
                 chargeFrame = 0;
                 chargeMashMagicTicks = 0;
-                if (currentAnim == animPlayerCharge) {
-                    currentAnim = animIdle;
-                    currentAnim->setSpeed(10);
+                if (anim.clip == ClipSet::PLAYERCHARGE) {
+                    anim.set(ClipSet::IDLE);
+                    anim.speed = 10;
                 }
             }
         }
@@ -470,11 +457,11 @@ void Player::update(Map& map)
 
     // Apply custom gravity modifiers BEFORE GameObject::update.
     // GameObject::update will add BASE_GRAVITY; to achieve a desired gravity
-    // this frame we set obj.vely so after GameObject::update's +BASE_GRAVITY it matches desired.
-    float desiredVel = obj.vely;
-    if (obj.vely > 0.0f) { // falling
+    // this frame we set obj->vely so after GameObject::update's +BASE_GRAVITY it matches desired.
+    float desiredVel = obj->vely;
+    if (obj->vely > 0.0f) { // falling
         desiredVel += BASE_GRAVITY * FAST_FALL_MULT;
-    } else if (obj.vely < 0.0f) { // rising
+    } else if (obj->vely < 0.0f) { // rising
         if (jumpHeld) {
             desiredVel += BASE_GRAVITY * HOLD_JUMP_MULT;
         } else {
@@ -485,14 +472,14 @@ void Player::update(Map& map)
         desiredVel += BASE_GRAVITY;
     }
 
-    // Set obj.vely so that GameObject::update's addition results in desiredVel
-    obj.vely = desiredVel - BASE_GRAVITY;
+    // Set obj->vely so that GameObject::update's addition results in desiredVel
+    obj->vely = desiredVel - BASE_GRAVITY;
 
     // If we're in any charge-related state, request GameObject::update preserve our animation
-    if ((chargeCharging || chargeMashMode || chargeDashed) && animPlayerCharge) {
+    if ((chargeCharging || chargeMashMode || chargeDashed) && clips) {
         preventAnimOverride = true;
-        currentAnim = animPlayerCharge;
-        currentAnim->setSpeed(std::max(1, CHARGE_TICKS_PER_FRAME));
+        anim.set(ClipSet::PLAYERCHARGE);
+        anim.speed = Uint8(std::max(1, CHARGE_TICKS_PER_FRAME));
     } else {
         preventAnimOverride = false;
     }
@@ -512,7 +499,7 @@ void Player::update(Map& map)
         } else {
             chargeDashing = false;
             // stop horizontal momentum after dash
-            obj.velx = 0;
+            obj->velx = 0;
         }
     }
 }
\ No newline at end of file
@@ -1,23 +1,54 @@
 #include "Potion.h"
+#include "ResourceTracker.h"
 #include "Player.h"
 #include "Engine.h"
 #include "Sound.h"
+#include <SDL3_image/SDL_image.h>
 
-Potion::Potion(SDL_Renderer* renderer, const std::string& spritePath, int tw, int th, float startX, float startY, Type t)
-    : GameObject(renderer, spritePath, tw, th), type(t)
+// Shared sprites, indexed by Type
+static SDL_Texture* s_potionTex[2] = { nullptr, nullptr };
+
+bool Potion::loadTextures(SDL_Renderer* renderer)
 {
-    obj.x = startX;
-    obj.y = startY;
-    obj.tileWidth = tw;
-    obj.tileHeight = th;
-    // Potions are small pickups: they should fall under gravity
-    obj.velx = 0;
-    obj.vely = 0;
-    // Replace animations (GameObject sets up AnimationManager for sprite sheets). Potions use a simple 16x16 image.
-    if (tex) {
-        SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
-        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    static const char* paths[2] = { "Assets/Sprites/healthPot.png", "Assets/Sprites/manaPot.png" };
+    bool ok = true;
+    for (int i = 0; i < 2; ++i) {
+        if (s_potionTex[i]) continue;
+        SDL_Surface* surf = IMG_Load(paths[i]);
+        if (!surf) {
+            SDL_Log("Potion: failed to load sprite '%s': %s", paths[i], SDL_GetError());
+            ok = false;
+            continue;
+        }
+        s_potionTex[i] = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "Potion", ResourceTracker::SESSION);
+        SDL_DestroySurface(surf);
+        if (s_potionTex[i]) {
+            SDL_SetTextureScaleMode(s_potionTex[i], SDL_SCALEMODE_NEAREST);
+            SDL_SetTextureBlendMode(s_potionTex[i], SDL_BLENDMODE_BLEND);
+        }
+    }
+    return ok;
+}
+
+void Potion::unloadTextures()
+{
+    for (auto*& t : s_potionTex) {
+        if (t) ResourceTracker::destroyTexture(t);
+        t = nullptr;
     }
+}
+
+Potion::Potion(SDL_Renderer* renderer, float startX, float startY, Type t)
+    : GameObject(renderer, "NULL", 16, 16), type(t)
+{
+    tracked.setOwner("Potion");
+    obj->x = startX;
+    obj->y = startY;
+    // Potions are small pickups: they should fall under gravity
+    obj->velx = 0;
+    obj->vely = 0;
+    // Potions draw a simple 16x16 image instead of the GameObject sprite sheet
+    sprite = s_potionTex[t == Type::HEALTH ? 0 : 1];
 
     // initialize blink
     blinkTimer = blinkInterval;
@@ -26,7 +57,7 @@ Potion::Potion(SDL_Renderer* renderer, const std::string& spritePath, int tw, in
 
 void Potion::update(Map& map)
 {
-    if (!obj.alive) return;
+    if (!obj->alive) return;
 
     // basic gravity + ground collision handled by GameObject::update
     GameObject::update(map);
@@ -38,36 +69,36 @@ void Potion::update(Map& map)
     }
 
     // If potion falls out of world, mark dead
-    if (obj.y > map.height * map.TILE_SIZE) obj.alive = false;
+    if (obj->y > map.height * map.TILE_SIZE) obj->alive = false;
 
     // Check pickup by player
-    if (gEngine && gEngine->player && gEngine->player->obj.alive) {
+    if (gEngine && gEngine->player && gEngine->player->obj->alive) {
         SDL_FRect pr = gEngine->player->getRect();
         SDL_FRect my = getRect();
         if (SDL_HasRectIntersectionFloat(&pr, &my)) {
             onPickup(gEngine->player);
-            obj.alive = false;
+            obj->alive = false;
         }
     }
 }
 
 SDL_FRect Potion::getRect() const
 {
-    return { obj.x, obj.y, (float)obj.tileWidth, (float)obj.tileHeight };
+    return { obj->x, obj->y, (float)obj->tileWidth, (float)obj->tileHeight };
 }
 
 void Potion::draw(SDL_Renderer* renderer, int camX, int camY)
 {
-    if (!obj.alive) return;
-    if (!tex) return;
+    if (!obj->alive) return;
+    if (!sprite) return;
 
     // If currently blinking invisible, skip draw
     if (!blinkVisible) return;
 
-    SDL_FRect src{ 0.0f, 0.0f, (float)obj.tileWidth, (float)obj.tileHeight };
-    SDL_FRect dst{ obj.x - camX, obj.y - camY, (float)obj.tileWidth, (float)obj.tileHeight };
+    SDL_FRect src{ 0.0f, 0.0f, (float)obj->tileWidth, (float)obj->tileHeight };
+    SDL_FRect dst{ obj->x - camX, obj->y - camY, (float)obj->tileWidth, (float)obj->tileHeight };
 
-    SDL_RenderTexture(renderer, tex, &src, &dst);
+    SDL_RenderTexture(renderer, sprite, &src, &dst);
 }
 
 void Potion::onPickup(Player* player)
@@ -76,12 +107,12 @@ void Potion::onPickup(Player* player)
 
     const float healPct = 0.20f; // restore 20%
     if (type == Type::HEALTH) {
-        float amount = player->obj.maxHealth * healPct;
-        player->obj.health = std::min(player->obj.maxHealth, player->obj.health + amount);
-        if (gSound) gSound->playSfx("arrow", 128);
+        float amount = player->stats.maxHealth * healPct;
+        player->stats.health = std::min(player->stats.maxHealth, player->stats.health + amount);
+        if (gSound) gSound->playSfx(Sfx::ARROW, 128);
     } else {
-        float amount = player->obj.maxMagic * healPct;
-        player->obj.magic = std::min(player->obj.maxMagic, player->obj.magic + amount);
-        if (gSound) gSound->playSfx("arrow", 128);
+        float amount = player->stats.maxMagic * healPct;
+        player->stats.magic = std::min(player->stats.maxMagic, player->stats.magic + amount);
+        if (gSound) gSound->playSfx(Sfx::ARROW, 128);
     }
 }
@@ -7,13 +7,11 @@ class Potion : public GameObject {
 public:
     enum class Type { HEALTH, MANA };
 
-    Potion(SDL_Renderer* renderer,
-           const std::string& spritePath,
-           int tw,
-           int th,
-           float startX,
-           float startY,
-           Type t);
+    Potion(SDL_Renderer* renderer, float startX, float startY, Type t);
+
+    // Potion sprites are shared by every instance; load once at startup, free at shutdown
+    static bool loadTextures(SDL_Renderer* renderer);
+    static void unloadTextures();
 
     void update(Map& map);
     SDL_FRect getRect() const;
@@ -24,6 +22,7 @@ public:
 
 private:
     Type type;
+    SDL_Texture* sprite = nullptr; // shared, owned by loadTextures()
 
     // Blink state: toggle visibility periodically to attract attention
     int blinkTimer = 0;       // ticks remaining until next toggle
@@ -1,9 +1,8 @@
 #include "PressurePlate.h"
+#include "AnimationManager.h"
 #include "GameObject.h"
 #include "Map.h"
 #include "Engine.h"
-#include "Orc.h"
-#include "Archer.h"
 #include "ArrowTrap.h"
 #include "Door.h"
 #include "FallingTrap.h"
@@ -13,6 +12,7 @@
 PressurePlate::PressurePlate(int tileX, int tileY, int tileIndex)
     : MapObject(tileX, tileY, tileIndex)
 {
+    tracked.setOwner("PressurePlate");
     // pressure plate is small: 19x3 pixels
     w = 19;
     h = 3;
@@ -36,7 +36,46 @@ PressurePlate::PressurePlate(int tileX, int tileY, int tileIndex)
 
 PressurePlate::~PressurePlate() = default;
 
-void PressurePlate::update(GameObject& obj, Map& /*map*/)
+void PressurePlate::link(const std::vector<ArrowTrap*>& arrowTraps, const std::vector<Door*>& doors,
+                         const std::vector<FallingTrap*>& fallingTraps)
+{
+    trapTargets.clear();
+    doorTarget = nullptr;
+    fallTarget = nullptr;
+
+    if (targetAction == TargetAction::FIRE_ARROWTRAPS) {
+        // traps within a generous vertical band that face this plate
+        SDL_FRect pr = getRect();
+        float pCenterX = pr.x + pr.w * 0.5f;
+        float pCenterY = pr.y + pr.h * 0.5f;
+        for (auto* at : arrowTraps) {
+            SDL_FRect tr = at->getRect();
+            if (pCenterY < tr.y - 400 || pCenterY > tr.y + tr.h + 400) continue;
+            int ti = at->getTileIndex();
+            if ((ti == Map::SPAWN_ARROWTRAP_LEFT && pCenterX < tr.x) ||
+                (ti == Map::SPAWN_ARROWTRAP_RIGHT && pCenterX > tr.x + tr.w))
+                trapTargets.push_back(at);
+        }
+    }
+    else if (targetAction == TargetAction::OPEN_DOOR) {
+        for (auto* d : doors) {
+            if (d->getTileX() == targetTx && d->getTileY() == targetTy) { doorTarget = d; break; }
+        }
+        if (!doorTarget) SDL_Log("PressurePlate: no door at (%d,%d) to link", targetTx, targetTy);
+    }
+    else if (targetAction == TargetAction::DROP_FALLINGTRAP) {
+        for (auto* ft : fallingTraps) {
+            // FallingTrap stores its x/y as pixels; compare tile coords
+            if (ft && int(ft->x / Map::TILE_SIZE) == targetTx && int(ft->y / Map::TILE_SIZE) == targetTy) {
+                fallTarget = ft;
+                break;
+            }
+        }
+        if (!fallTarget) SDL_Log("PressurePlate: no falling trap at (%d,%d) to link", targetTx, targetTy);
+    }
+}
+
+void PressurePlate::evaluate(SpatialHash& broadphase, Map& map)
 {
     if (!active) return;
     // Use a small hitbox 2px high anchored at the bottom of the plate
@@ -44,93 +83,30 @@ void PressurePlate::update(GameObject& obj, Map& /*map*/)
     plateHit.y = plateHit.y + float(plateHit.h - 2);
     plateHit.h = 2.0f;
 
-    // When called with the player first each frame, perform a full scan of relevant objects
-    if (gEngine && gEngine->player && &obj == gEngine->player) {
-        triggered = false;
-
-        // check player
-        SDL_FRect pr = gEngine->player->getRect();
-        if (SDL_HasRectIntersectionFloat(&plateHit, &pr)) triggered = true;
-
-        // check all map objects (includes crates and other MapObject-derived items)
-        for (auto* mo : gEngine->objects) {
-            if (!mo || !mo->active) continue;
-            if (mo == this) continue;
-            SDL_FRect mr = mo->getRect();
-            if (SDL_HasRectIntersectionFloat(&plateHit, &mr)) { triggered = true; break; }
-        }
-
-        // check orcs
-        for (auto* o : gEngine->orc) {
-            if (!o || !o->obj.alive) continue;
-            SDL_FRect orr = o->getRect();
-            if (SDL_HasRectIntersectionFloat(&plateHit, &orr)) { triggered = true; break; }
-        }
-
-        // check archers
-        for (auto* a : gEngine->archers) {
-            if (!a || !a->obj.alive) continue;
-            SDL_FRect ar = a->getRect();
-            if (SDL_HasRectIntersectionFloat(&plateHit, &ar)) { triggered = true; break; }
+    // the player, map objects (crates etc.), orcs and archers standing on the plate
+    triggered = false;
+    broadphase.query(plateHit, SpatialHash::ACTOR | SpatialHash::MAPOBJECT, touching);
+    for (auto* e : touching) {
+        SDL_FRect r;
+        if (e->object) {
+            if (e->object == this || !e->object->active) continue;
+            r = e->object->getRect();
+        } else {
+            if (!e->actor->obj->alive) continue;
+            r = e->actor->getRect();
         }
-    }
-    else {
-        // Otherwise only check the supplied object (player/orc/archer)
-        SDL_FRect other = obj.getRect();
-        if (SDL_HasRectIntersectionFloat(&plateHit, &other)) triggered = true;
+        if (SDL_HasRectIntersectionFloat(&plateHit, &r)) { triggered = true; break; }
     }
 
     // Update animation frame based on triggered state
     if (anim) anim->currentFrame = triggered ? 1 : 0;
 
-    // If this plate became newly triggered this frame, perform configured action
+    // If this plate became newly triggered this tick, fire the linked targets
     if (triggered && !prevTriggered) {
-        if (gEngine) {
-            // Choose action by configured targetAction
-            if (targetAction == TargetAction::FIRE_ARROWTRAPS) {
-                SDL_FRect pr = getRect();
-                float pCenterX = pr.x + pr.w * 0.5f;
-                float pCenterY = pr.y + pr.h * 0.5f;
-                for (auto* mo : gEngine->objects) {
-                    if (!mo || !mo->active) continue;
-                    ArrowTrap* at = dynamic_cast<ArrowTrap*>(mo);
-                    if (!at) continue;
-                    SDL_FRect tr = at->getRect();
-                    // simple vertical band check (+/- 8 px) and horizontal in front check
-                    if (pCenterY < tr.y - 400 || pCenterY > tr.y + tr.h + 400) continue;
-                    float trapLeft = tr.x;
-                    float trapRight = tr.x + tr.w;
-                    int ti = at->getTileIndex();
-                    bool shootLeft = (ti == Map::SPAWN_ARROWTRAP_LEFT);
-                    bool shootRight = (ti == Map::SPAWN_ARROWTRAP_RIGHT);
-                    if (shootLeft && pCenterX < trapLeft) at->triggerExternal();
-                    if (shootRight && pCenterX > trapRight) at->triggerExternal();
-                }
-            }
-            else if (targetAction == TargetAction::OPEN_DOOR) {
-                // find door at target tile coords
-                for (auto* mo : gEngine->objects) {
-                    if (!mo || !mo->active) continue;
-                    Door* d = dynamic_cast<Door*>(mo);
-                    if (!d) continue;
-                    if (d->getTileX() == targetTx && d->getTileY() == targetTy) {
-                        d->open();
-                    }
-                }
-            }
-            else if (targetAction == TargetAction::DROP_FALLINGTRAP) {
-                for (auto* ft : gEngine->fallT) {
-                    if (!ft) continue;
-                    // match by tile coords
-                    // FallingTrap stores its x/y as pixels; compute tile coords
-                    int fx = int(ft->x / Map::TILE_SIZE);
-                    int fy = int(ft->y / Map::TILE_SIZE);
-                    if (fx == targetTx && fy == targetTy) {
-                        ft->checkTrigger(*gEngine->player, gEngine->map);
-                    }
-                }
-            }
-        }
+        for (auto* at : trapTargets)
+            if (at->active) at->triggerExternal();
+        if (doorTarget && doorTarget->active) doorTarget->open();
+        if (fallTarget && gEngine && gEngine->player) fallTarget->checkTrigger(*gEngine->player, map);
     }
 
     prevTriggered = triggered;
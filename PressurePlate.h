@@ -1,12 +1,24 @@
 #pragma once
 #include "MapObject.h"
+#include "SpatialHash.h"
+#include <vector>
+
+class ArrowTrap;
+class Door;
+class FallingTrap;
 
 class PressurePlate : public MapObject {
 public:
     PressurePlate(int tileX, int tileY, int tileIndex);
     ~PressurePlate();
 
-    void update(GameObject& obj, Map& map) override;
+    // Plates are evaluated once per tick by the engine (evaluate()), not per actor
+    void update(GameObject&, Map&) override {}
+    // the frame follows the pressed state set by evaluate(), not the animation timer
+    void wake(int) override {}
+    // Recompute the pressed state from everything standing on the plate and fire the
+    // linked targets on a rising edge. The broadphase must be current.
+    void evaluate(SpatialHash& broadphase, Map& map);
     void draw(SDL_Renderer* renderer, int camX, int camY, const Map& map) const override;
 
     bool isTriggered() const { return triggered; }
@@ -20,6 +32,9 @@ public:
 
     void setTargetAction(TargetAction a, int tx = -1, int ty = -1) { targetAction = a; targetTx = tx; targetTy = ty; }
     TargetAction getTargetAction() const { return targetAction; }
+    // Resolve the configured action to direct target handles (once per level load)
+    void link(const std::vector<ArrowTrap*>& arrowTraps, const std::vector<Door*>& doors,
+              const std::vector<FallingTrap*>& fallingTraps);
 
 private:
     bool triggered = false;
@@ -27,6 +42,10 @@ private:
     TargetAction targetAction = TargetAction::NONE;
     int targetTx = -1;
     int targetTy = -1;
+    std::vector<ArrowTrap*> trapTargets; // FIRE_ARROWTRAPS
+    Door* doorTarget = nullptr;          // OPEN_DOOR
+    FallingTrap* fallTarget = nullptr;   // DROP_FALLINGTRAP
     int animTimer = 0;
     int animInterval = 12;
+    std::vector<SpatialHash::Entry*> touching; // broadphase candidates for the plate scan
 };
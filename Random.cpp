@@ -0,0 +1,36 @@
+#include "Random.h"
+
+RngStreams gRng;
+
+static Uint64 splitmix64(Uint64& x)
+{
+    Uint64 z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void Rng::reseed(Uint64 seed)
+{
+    Uint64 x = seed;
+    Uint64 a = splitmix64(x);
+    Uint64 b = splitmix64(x);
+    s[0] = Uint32(a);
+    s[1] = Uint32(a >> 32);
+    s[2] = Uint32(b);
+    s[3] = Uint32(b >> 32);
+    // all-zero state would only ever produce zeros
+    if ((s[0] | s[1] | s[2] | s[3]) == 0) s[0] = 1;
+}
+
+void RngStreams::seed(Uint64 seed_)
+{
+    sessionSeed = seed_;
+    // each stream starts from its own point of one splitmix sequence
+    Uint64 x = seed_;
+    ai.reseed(splitmix64(x));
+    camera.reseed(splitmix64(x));
+    sound.reseed(splitmix64(x));
+    loot.reseed(splitmix64(x));
+    level.reseed(splitmix64(x));
+}
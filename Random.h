@@ -0,0 +1,53 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// Small, fast PRNG (xoshiro128**). Cheap to copy and to keep per object.
+class Rng {
+public:
+    explicit Rng(Uint64 seed = 0) { reseed(seed); }
+
+    // Expand a 64-bit seed into the generator state (splitmix64)
+    void reseed(Uint64 seed);
+
+    Uint32 next()
+    {
+        const Uint32 result = rotl(s[1] * 5, 7) * 9;
+        const Uint32 t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // Uniform integer in [min, max]
+    int range(int min, int max)
+    {
+        Uint32 span = Uint32(max - min) + 1;
+        return min + int((Uint64(next()) * span) >> 32);
+    }
+    // True with probability percent / 100
+    bool chance(int percent) { return range(0, 99) < percent; }
+
+private:
+    static Uint32 rotl(Uint32 x, int k) { return (x << k) | (x >> (32 - k)); }
+    Uint32 s[4];
+};
+
+// Gameplay random streams, one per subsystem, all derived from a single session seed.
+// A subsystem drawing more or fewer numbers never shifts another's sequence, and a run
+// can be reproduced by starting with the same seed.
+struct RngStreams {
+    Uint64 sessionSeed = 0;
+    Rng ai;      // enemy spawn rolls; each enemy then owns a stream seeded from here
+    Rng camera;  // screen shake
+    Rng sound;   // sfx variations
+    Rng loot;    // drops
+    Rng level;   // per-level choices in loadLevel
+
+    void seed(Uint64 sessionSeed);
+};
+
+extern RngStreams gRng;
@@ -0,0 +1,196 @@
+#include "ResourceTracker.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    struct Record {
+        ResourceTracker::Kind kind;
+        ResourceTracker::Scope scope;
+        const char* owner;
+        int level;      // level counter when it was created (0 = startup)
+    };
+
+    struct Counts {
+        int live = 0;
+        int created = 0;    // since the last level report
+        int destroyed = 0;
+    };
+
+    // Function statics: resources can be registered during static init
+    std::unordered_map<const void*, Record>& records()
+    {
+        static std::unordered_map<const void*, Record> r;
+        return r;
+    }
+
+    // Token counters, one per kind + owner. Slots are only added for new owner names.
+    struct OwnerSlot {
+        ResourceTracker::Kind kind;
+        const char* owner;
+        int live = 0;
+        int levelLive = 0;  // live ones created after the first level load
+    };
+
+    std::vector<OwnerSlot>& slots()
+    {
+        static std::vector<OwnerSlot> s;
+        return s;
+    }
+
+    Counts sCounts[ResourceTracker::KIND_COUNT];
+    int sLevel = 0;         // number of level reports so far
+    int sLevelID = -1;      // level id currently being counted
+
+    const char* kindName(int kind)
+    {
+        static const char* names[ResourceTracker::KIND_COUNT] = { "textures", "audio streams", "animations", "entities" };
+        return names[kind];
+    }
+
+    struct OwnerCount {
+        int kind;
+        const char* owner;
+        int count;
+    };
+
+    // Group matching records by kind + owner, add the token counts, most frequent first
+    template <class Pred, class SlotCount>
+    std::vector<OwnerCount> groupByOwner(Pred pred, SlotCount slotCount)
+    {
+        std::vector<OwnerCount> out;
+        for (auto& kv : records()) {
+            const Record& r = kv.second;
+            if (!pred(r)) continue;
+            auto it = std::find_if(out.begin(), out.end(), [&](const OwnerCount& o) {
+                return o.kind == r.kind && std::strcmp(o.owner, r.owner) == 0;
+            });
+            if (it != out.end()) ++it->count;
+            else out.push_back({ r.kind, r.owner, 1 });
+        }
+        for (const OwnerSlot& s : slots()) {
+            int n = slotCount(s);
+            if (n > 0) out.push_back({ s.kind, s.owner, n });
+        }
+        std::sort(out.begin(), out.end(), [](const OwnerCount& a, const OwnerCount& b) {
+            return a.count != b.count ? a.count > b.count : a.kind < b.kind;
+        });
+        return out;
+    }
+
+    // One line: created/destroyed since the last report and live now, per kind
+    void logCounts(const char* label)
+    {
+        char line[256];
+        int len = std::snprintf(line, sizeof(line), "ResourceTracker: %s:", label);
+        for (int k = 0; k < ResourceTracker::KIND_COUNT && len < (int)sizeof(line); ++k) {
+            const Counts& c = sCounts[k];
+            len += std::snprintf(line + len, sizeof(line) - len, " %s +%d/-%d (%d live)%s",
+                kindName(k), c.created, c.destroyed, c.live, k + 1 < ResourceTracker::KIND_COUNT ? "," : "");
+        }
+        SDL_Log("%s", line);
+    }
+}
+
+void ResourceTracker::created(Kind kind, const void* ptr, const char* owner, Scope scope)
+{
+    if (!ptr) return;
+    auto res = records().insert_or_assign(ptr, Record{ kind, scope, owner ? owner : "?", sLevel });
+    if (!res.second) {
+        // address reused without a destroyed() call: the old resource was never reported freed
+        SDL_Log("ResourceTracker: %s re-registered at %p (missing destroy?)", owner ? owner : "?", ptr);
+        return;
+    }
+    ++sCounts[kind].live;
+    ++sCounts[kind].created;
+}
+
+void ResourceTracker::destroyed(const void* ptr)
+{
+    if (!ptr) return;
+    auto it = records().find(ptr);
+    if (it == records().end()) return;
+    Counts& c = sCounts[it->second.kind];
+    --c.live;
+    ++c.destroyed;
+    records().erase(it);
+}
+
+Uint16 ResourceTracker::slotFor(Kind kind, const char* owner)
+{
+    auto& s = slots();
+    for (size_t i = 0; i < s.size(); ++i)
+        if (s[i].kind == kind && (s[i].owner == owner || std::strcmp(s[i].owner, owner) == 0)) return Uint16(i);
+    s.push_back({ kind, owner });
+    return Uint16(s.size() - 1);
+}
+
+void ResourceTracker::Token::enter()
+{
+    OwnerSlot& s = slots()[slot];
+    inLevel = sLevel > 0;
+    ++s.live;
+    if (inLevel) ++s.levelLive;
+    ++sCounts[s.kind].live;
+    ++sCounts[s.kind].created;
+}
+
+void ResourceTracker::Token::leave()
+{
+    OwnerSlot& s = slots()[slot];
+    --s.live;
+    if (inLevel) --s.levelLive;
+    --sCounts[s.kind].live;
+    ++sCounts[s.kind].destroyed;
+}
+
+void ResourceTracker::Token::setOwner(const char* owner)
+{
+    // move this token's count to the new name without counting a create/destroy
+    OwnerSlot& from = slots()[slot];
+    --from.live;
+    if (inLevel) --from.levelLive;
+    slot = slotFor(from.kind, owner);
+    OwnerSlot& to = slots()[slot];
+    ++to.live;
+    if (inLevel) ++to.levelLive;
+}
+
+const char* ResourceTracker::Token::owner() const
+{
+    return slots()[slot].owner;
+}
+
+int ResourceTracker::live(Kind kind)
+{
+    return sCounts[kind].live;
+}
+
+void ResourceTracker::levelReport(int nextLevelID)
+{
+    if (sLevel > 0) {
+        char label[32];
+        std::snprintf(label, sizeof(label), "level %03d", sLevelID);
+        logCounts(label);
+
+        // anything a level created that is still alive after cleanup leaked with it
+        auto leaks = groupByOwner([](const Record& r) { return r.scope == LEVEL && r.level > 0; },
+                                  [](const OwnerSlot& s) { return s.levelLive; });
+        for (const OwnerCount& o : leaks)
+            SDL_Log("ResourceTracker:   leaked %d %s from %s", o.count, kindName(o.kind), o.owner);
+    }
+
+    for (Counts& c : sCounts) c.created = c.destroyed = 0;
+    ++sLevel;
+    sLevelID = nextLevelID;
+}
+
+void ResourceTracker::shutdownReport()
+{
+    logCounts("shutdown");
+    auto alive = groupByOwner([](const Record&) { return true; }, [](const OwnerSlot& s) { return s.live; });
+    for (const OwnerCount& o : alive)
+        SDL_Log("ResourceTracker:   never freed %d %s from %s", o.count, kindName(o.kind), o.owner);
+}
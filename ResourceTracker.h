@@ -0,0 +1,60 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// Counts live engine resources (textures, audio streams, animation managers, entities) with
+// the name of whoever created them. Engine::loadLevel prints what the previous level created
+// and destroyed, plus anything it made that outlived cleanupObjects(), so slow VRAM/RSS growth
+// over long sessions shows up as a named leak instead of a number in the task manager.
+class ResourceTracker {
+public:
+    enum Kind : Uint8 { TEXTURE, AUDIO_STREAM, ANIMATION, ENTITY, KIND_COUNT };
+
+    // SESSION resources are shared caches that are meant to outlive a level: they are
+    // counted but never reported as level leaks
+    enum Scope : Uint8 { LEVEL, SESSION };
+
+    // Register/unregister a resource by address. `owner` must be a string literal.
+    // Null pointers are ignored, so these can wrap creation calls that may fail.
+    static void created(Kind kind, const void* ptr, const char* owner, Scope scope = LEVEL);
+    static void destroyed(const void* ptr);
+
+    // Shorthands for SDL call sites: register what a create call returned / unregister and destroy
+    static SDL_Texture* track(SDL_Texture* tex, const char* owner, Scope scope = LEVEL) { created(TEXTURE, tex, owner, scope); return tex; }
+    static SDL_AudioStream* track(SDL_AudioStream* stream, const char* owner, Scope scope = LEVEL) { created(AUDIO_STREAM, stream, owner, scope); return stream; }
+    static void destroyTexture(SDL_Texture* tex) { destroyed(tex); SDL_DestroyTexture(tex); }
+    static void destroyStream(SDL_AudioStream* stream) { destroyed(stream); SDL_DestroyAudioStream(stream); }
+
+    // Log the level that just ended and start counting the next one.
+    // Call after the old level is cleaned up and before the new one loads.
+    static void levelReport(int nextLevelID);
+    // Log everything still alive; call at shutdown after all owners are released
+    static void shutdownReport();
+
+    static int live(Kind kind);
+
+    // Member that counts its owning object for as long as it exists (entities, animations).
+    // Copies count themselves, so cloned entities are included. Count-only: a token just
+    // bumps its owner's counters, so pooled objects never allocate when they are created.
+    class Token {
+    public:
+        Token(Kind kind, const char* owner) : slot(slotFor(kind, owner)) { enter(); }
+        Token(const Token& other) : slot(other.slot) { enter(); }
+        Token& operator=(const Token&) { return *this; }
+        ~Token() { leave(); }
+
+        // Subclasses rename the token in their constructor so reports show the real type
+        void setOwner(const char* owner);
+        const char* owner() const;
+
+    private:
+        void enter();
+        void leave();
+
+        Uint16 slot;
+        bool inLevel = false;   // created after the first level load (can leak with a level)
+    };
+
+private:
+    // Per-owner counters behind the tokens; returns the slot for kind + owner
+    static Uint16 slotFor(Kind kind, const char* owner);
+};
@@ -1,4 +1,5 @@
 #include "Sound.h"
+#include "ResourceTracker.h"
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_audio.h>
 #include <SDL3/SDL_iostream.h>
@@ -6,9 +7,70 @@
 #include <iostream>
 #include <cstdint>
 #include <algorithm>
+#include <unordered_map>
 
 Sound* gSound = nullptr;
 
+// Name table behind the handles. Function statics so interning is safe during static init.
+static std::vector<std::string>& internNames()
+{
+    static std::vector<std::string> names;
+    return names;
+}
+
+static std::unordered_map<std::string, SfxId>& internIds()
+{
+    static std::unordered_map<std::string, SfxId> ids;
+    return ids;
+}
+
+SfxId Sound::intern(const std::string& name)
+{
+    auto& ids = internIds();
+    auto it = ids.find(name);
+    if (it != ids.end()) return it->second;
+    SfxId id = (SfxId)internNames().size();
+    internNames().push_back(name);
+    ids.emplace(name, id);
+    return id;
+}
+
+const std::string& Sound::nameOf(SfxId id)
+{
+    static const std::string none = "<none>";
+    auto& names = internNames();
+    return (id >= 0 && id < (SfxId)names.size()) ? names[id] : none;
+}
+
+namespace Sfx {
+    const SfxId HIT = Sound::intern("hit");
+    const SfxId ORC_HIT = Sound::intern("orc_hit");
+    const SfxId WALK = Sound::intern("walk");
+    const SfxId DEATH = Sound::intern("death");
+    const SfxId ORC_DEATH = Sound::intern("orc_death");
+    const SfxId HEARTBEAT = Sound::intern("heartbeat");
+    const SfxId STEP = Sound::intern("step");
+    const SfxId JUMP1 = Sound::intern("jump1");
+    const SfxId JUMP2 = Sound::intern("jump2");
+    const SfxId ATTACK1 = Sound::intern("attack1");
+    const SfxId ATTACK2 = Sound::intern("attack2");
+    const SfxId ATTACK3 = Sound::intern("attack3");
+    const SfxId CHARGE_START = Sound::intern("charge_start");
+    const SfxId CHARGE_DASH = Sound::intern("charge_dash");
+    const SfxId FALLTRAP_RELEASE = Sound::intern("fallTrapRelease");
+    const SfxId FALLTRAP_LAND = Sound::intern("fallTrapLand");
+    const SfxId FALL_PLAT = Sound::intern("fall_plat");
+    const SfxId CLANG = Sound::intern("clang");
+    const SfxId ARROW = Sound::intern("arrow");
+    const SfxId ARROW_IMPACT = Sound::intern("arrow_impact");
+    const SfxId ARROW_EMPTY = Sound::intern("arrow_empty");
+    const SfxId MONSTER = Sound::intern("monster");
+    const SfxId ORC_LAUGH = Sound::intern("orc_laugh");
+    const SfxId LOCK_OPEN = Sound::intern("lock_open");
+    const SfxId LOCK_FAIL = Sound::intern("lock_fail");
+    const SfxId DOOR_OPEN = Sound::intern("door_open");
+}
+
 static void mixAudioFormat(void* dst, const void* src, SDL_AudioFormat format, int len, int volume)
 {
     if (len <= 0 || volume <= 0) return;
@@ -61,6 +123,12 @@ static void mixAudioFormat(void* dst, const void* src, SDL_AudioFormat format, i
 Sound::Sound() {}
 Sound::~Sound() { shutdown(); }
 
+Sound::Slot& Sound::slot(SfxId id)
+{
+    if (id >= (SfxId)slots.size()) slots.resize(id + 1);
+    return slots[id];
+}
+
 bool Sound::init()
 {
     // Open default playback device with no specific hint; query preferred format via SDL_GetAudioDeviceFormat
@@ -88,28 +156,20 @@ void Sound::shutdown()
     stopMusic();
 
     // destroy active streams
-    for (auto s : activeStreams) {
-        SDL_DestroyAudioStream(s);
+    for (auto& a : activeStreams) {
+        ResourceTracker::destroyStream(a.stream);
     }
     activeStreams.clear();
 
-    // clear playingSfx map
-    for (auto &kv : playingSfx) {
-        kv.second.clear();
-    }
-    playingSfx.clear();
-
-    lastPlayTimeMs.clear();
-
     if (musicStream) {
-        SDL_DestroyAudioStream(musicStream);
+        ResourceTracker::destroyStream(musicStream);
         musicStream = nullptr;
     }
 
-    for (auto& kv : loaded) {
-        if (kv.second.buffer) SDL_free(kv.second.buffer);
+    for (auto& sl : slots) {
+        if (sl.data.buffer) SDL_free(sl.data.buffer);
     }
-    loaded.clear();
+    slots.clear();
 
     if (device) {
         SDL_CloseAudioDevice(device);
@@ -119,7 +179,8 @@ void Sound::shutdown()
 
 bool Sound::loadWav(const std::string& id, const std::string& path)
 {
-    if (loaded.find(id) != loaded.end()) return true;
+    SfxId h = intern(id);
+    if (slot(h).loaded) return true;
 
     SDL_AudioSpec spec;
     Uint8* audio_buf = nullptr;
@@ -147,66 +208,64 @@ bool Sound::loadWav(const std::string& id, const std::string& path)
         spec.channels = deviceSpec.channels;
     }
 
-    AudioData d;
-    d.buffer = audio_buf;
-    d.length = audio_len;
-    d.spec = spec;
-
-    loaded[id] = d;
+    Slot& sl = slot(h);
+    sl.data.buffer = audio_buf;
+    sl.data.length = audio_len;
+    sl.data.spec = spec;
+    sl.loaded = true;
     SDL_Log("Sound: loaded %s (%u bytes)", id.c_str(), audio_len);
     return true;
 }
 
-void Sound::playSfx(const std::string& id, int volume, bool allowOverlap, int minIntervalMs)
+void Sound::playSfx(SfxId id, int volume, bool allowOverlap, int minIntervalMs)
 {
-    auto it = loaded.find(id);
-    if (it == loaded.end()) {
-        SDL_Log("Sound: sfx not loaded: %s", id.c_str());
+    if (id < 0 || id >= (SfxId)slots.size() || !slots[id].loaded) {
+        SDL_Log("Sound: sfx not loaded: %s", nameOf(id).c_str());
         return;
     }
+    Slot& sl = slots[id];
+    const AudioData& data = sl.data;
 
     Uint32 now = SDL_GetTicks();
-    auto tIt = lastPlayTimeMs.find(id);
-    if (minIntervalMs > 0 && tIt != lastPlayTimeMs.end()) {
-        Uint32 last = tIt->second;
-        if (now - last < (Uint32)minIntervalMs) {
+    if (minIntervalMs > 0 && sl.played) {
+        if (now - sl.lastPlayTimeMs < (Uint32)minIntervalMs) {
             // Too soon to re-trigger
             return;
         }
     }
 
     // If overlap is not allowed and there's already an active instance, skip
-    auto pit = playingSfx.find(id);
-    if (!allowOverlap && pit != playingSfx.end() && !pit->second.empty()) {
+    if (!allowOverlap && !sl.playing.empty()) {
         // update last play time even if skipped to prevent burst retriggers
-        lastPlayTimeMs[id] = now;
+        sl.lastPlayTimeMs = now;
+        sl.played = true;
         return;
     }
 
-    SDL_AudioStream* stream = SDL_CreateAudioStream(&it->second.spec, &deviceSpec);
+    SDL_AudioStream* stream = ResourceTracker::track(SDL_CreateAudioStream(&data.spec, &deviceSpec), "Sound sfx", ResourceTracker::SESSION);
     if (!stream) {
         SDL_Log("Sound: SDL_CreateAudioStream failed: %s", SDL_GetError());
         return;
     }
 
     if (volume == 128) {
-        if (!SDL_PutAudioStreamData(stream, it->second.buffer, (int)it->second.length)) {
+        if (!SDL_PutAudioStreamData(stream, data.buffer, (int)data.length)) {
             SDL_Log("Sound: SDL_PutAudioStreamData failed: %s", SDL_GetError());
-            SDL_DestroyAudioStream(stream);
+            ResourceTracker::destroyStream(stream);
             return;
         }
     } else {
-        Uint8* temp = (Uint8*)SDL_malloc(it->second.length);
+        Uint8* temp = (Uint8*)SDL_malloc(data.length);
         if (!temp) {
             SDL_Log("Sound: malloc failed for sfx volume mixing");
-            SDL_DestroyAudioStream(stream);
+            ResourceTracker::destroyStream(stream);
             return;
         }
-        mixAudioFormat(temp, it->second.buffer, deviceSpec.format, (int)it->second.length, volume);
-        if (!SDL_PutAudioStreamData(stream, temp, (int)it->second.length)) {
+        mixAudioFormat(temp, data.buffer, deviceSpec.format, (int)data.length, volume);
+        if (!SDL_PutAudioStreamData(stream, temp, (int)data.length)) {
             SDL_Log("Sound: SDL_PutAudioStreamData failed for sfx (mixed): %s", SDL_GetError());
             SDL_free(temp);
-            SDL_DestroyAudioStream(stream);
+            ResourceTracker::destroyStream(stream);
             return;
         }
         SDL_free(temp);
@@ -214,88 +273,85 @@ void Sound::playSfx(const std::string& id, int volume, bool allowOverlap, int mi
 
     if (!SDL_BindAudioStream(device, stream)) {
         SDL_Log("Sound: SDL_BindAudioStream failed: %s", SDL_GetError());
-        SDL_DestroyAudioStream(stream);
+        ResourceTracker::destroyStream(stream);
         return;
     }
 
-    activeStreams.push_back(stream);
-    playingSfx[id].push_back(stream);
-    lastPlayTimeMs[id] = now;
+    activeStreams.push_back({ stream, id });
+    sl.playing.push_back(stream);
+    sl.lastPlayTimeMs = now;
+    sl.played = true;
 }
 
-void Sound::stopSfx(const std::string& id)
+void Sound::stopSfx(SfxId id)
 {
-    auto pit = playingSfx.find(id);
-    if (pit == playingSfx.end()) return;
+    if (id < 0 || id >= (SfxId)slots.size() || slots[id].playing.empty()) return;
+    Slot& sl = slots[id];
 
-    for (SDL_AudioStream* s : pit->second) {
+    for (SDL_AudioStream* s : sl.playing) {
         SDL_UnbindAudioStream(s);
-        SDL_DestroyAudioStream(s);
-        for (auto it = activeStreams.begin(); it != activeStreams.end(); ++it) {
-            if (*it == s) { activeStreams.erase(it); break; }
-        }
+        ResourceTracker::destroyStream(s);
     }
+    sl.playing.clear();
 
-    playingSfx.erase(pit);
+    activeStreams.erase(std::remove_if(activeStreams.begin(), activeStreams.end(),
+        [id](const ActiveStream& a) { return a.id == id; }), activeStreams.end());
 }
 
 void Sound::stopAllSfx()
 {
-    for (auto& kv : playingSfx) {
-        for (SDL_AudioStream* s : kv.second) {
-            SDL_UnbindAudioStream(s);
-            SDL_DestroyAudioStream(s);
-        }
+    for (auto& a : activeStreams) {
+        SDL_UnbindAudioStream(a.stream);
+        ResourceTracker::destroyStream(a.stream);
     }
-    playingSfx.clear();
-
-    for (auto s : activeStreams) SDL_DestroyAudioStream(s);
     activeStreams.clear();
+
+    for (auto& sl : slots) sl.playing.clear();
 }
 
-void Sound::playMusic(const std::string& id, bool loop, int volume)
+void Sound::playMusic(SfxId id, bool loop, int volume)
 {
     if (musicMuted) return; // respect mute
 
-    auto it = loaded.find(id);
-    if (it == loaded.end()) {
-        SDL_Log("Sound: music not loaded: %s", id.c_str());
+    if (id < 0 || id >= (SfxId)slots.size() || !slots[id].loaded) {
+        SDL_Log("Sound: music not loaded: %s", nameOf(id).c_str());
         return;
     }
+    const AudioData& data = slots[id].data;
 
     // stop existing music
     if (musicStream) {
         SDL_UnbindAudioStream(musicStream);
-        SDL_DestroyAudioStream(musicStream);
+        ResourceTracker::destroyStream(musicStream);
         musicStream = nullptr;
     }
 
-    musicStream = SDL_CreateAudioStream(&it->second.spec, &deviceSpec);
+    musicStream = ResourceTracker::track(SDL_CreateAudioStream(&data.spec, &deviceSpec), "Sound music", ResourceTracker::SESSION);
     if (!musicStream) {
         SDL_Log("Sound: SDL_CreateAudioStream failed for music: %s", SDL_GetError());
         return;
     }
 
     if (volume == 128) {
-        if (!SDL_PutAudioStreamData(musicStream, it->second.buffer, (int)it->second.length)) {
+        if (!SDL_PutAudioStreamData(musicStream, data.buffer, (int)data.length)) {
             SDL_Log("Sound: SDL_PutAudioStreamData failed for music: %s", SDL_GetError());
-            SDL_DestroyAudioStream(musicStream);
+            ResourceTracker::destroyStream(musicStream);
             musicStream = nullptr;
             return;
         }
     } else {
-        Uint8* temp = (Uint8*)SDL_malloc(it->second.length);
+        Uint8* temp = (Uint8*)SDL_malloc(data.length);
         if (!temp) {
             SDL_Log("Sound: malloc failed for music volume mixing");
-            SDL_DestroyAudioStream(musicStream);
+            ResourceTracker::destroyStream(musicStream);
             musicStream = nullptr;
             return;
         }
-        mixAudioFormat(temp, it->second.buffer, deviceSpec.format, (int)it->second.length, volume);
-        if (!SDL_PutAudioStreamData(musicStream, temp, (int)it->second.length)) {
+        mixAudioFormat(temp, data.buffer, deviceSpec.format, (int)data.length, volume);
+        if (!SDL_PutAudioStreamData(musicStream, temp, (int)data.length)) {
             SDL_Log("Sound: SDL_PutAudioStreamData failed for music (mixed): %s", SDL_GetError());
             SDL_free(temp);
-            SDL_DestroyAudioStream(musicStream);
+            ResourceTracker::destroyStream(musicStream);
             musicStream = nullptr;
             return;
         }
@@ -304,7 +360,7 @@ void Sound::playMusic(const std::string& id, bool loop, int volume)
 
     if (!SDL_BindAudioStream(device, musicStream)) {
         SDL_Log("Sound: SDL_BindAudioStream failed for music: %s", SDL_GetError());
-        SDL_DestroyAudioStream(musicStream);
+        ResourceTracker::destroyStream(musicStream);
         musicStream = nullptr;
         return;
     }
@@ -318,7 +374,7 @@ void Sound::stopMusic()
 {
     if (!musicStream) return;
     SDL_UnbindAudioStream(musicStream);
-    SDL_DestroyAudioStream(musicStream);
+    ResourceTracker::destroyStream(musicStream);
     musicStream = nullptr;
 }
 
@@ -329,12 +385,12 @@ void Sound::setMusicMuted(bool muted)
         // immediately stop music stream
         if (musicStream) {
             SDL_UnbindAudioStream(musicStream);
-            SDL_DestroyAudioStream(musicStream);
+            ResourceTracker::destroyStream(musicStream);
             musicStream = nullptr;
         }
     } else {
         // if unmuting, re-start music if an id exists
-        if (!musicId.empty()) {
+        if (musicId != NO_SFX) {
             playMusic(musicId, musicLoop, musicVolume);
         }
     }
@@ -345,44 +401,34 @@ void Sound::update()
     // Clean up any streams that are no longer bound or have no available data
     auto it = activeStreams.begin();
     while (it != activeStreams.end()) {
-        SDL_AudioStream* s = *it;
+        SDL_AudioStream* s = it->stream;
         int available = SDL_GetAudioStreamAvailable(s);
         if (available <= 0) {
-            // find any id in playingSfx mapped to this stream and remove it
-            for (auto &kv : playingSfx) {
-                for (auto vit = kv.second.begin(); vit != kv.second.end();) {
-                    if (*vit == s) vit = kv.second.erase(vit);
-                    else ++vit;
-                }
-            }
+            // drop it from its own slot's instance list
+            auto& playing = slots[it->id].playing;
+            playing.erase(std::remove(playing.begin(), playing.end(), s), playing.end());
 
             SDL_UnbindAudioStream(s);
-            SDL_DestroyAudioStream(s);
+            ResourceTracker::destroyStream(s);
             it = activeStreams.erase(it);
         } else {
             ++it;
         }
     }
 
-    // Remove empty vectors from playingSfx
-    for (auto pit = playingSfx.begin(); pit != playingSfx.end();) {
-        if (pit->second.empty()) pit = playingSfx.erase(pit);
-        else ++pit;
-    }
-
     // Handle music looping: if musicStream drained and loop=true, requeue
     if (musicStream && musicLoop) {
         int avail = SDL_GetAudioStreamAvailable(musicStream);
         if (avail <= 0) {
-            auto it2 = loaded.find(musicId);
-            if (it2 != loaded.end()) {
+            if (musicId >= 0 && musicId < (SfxId)slots.size() && slots[musicId].loaded) {
+                const AudioData& data = slots[musicId].data;
                 if (musicVolume == 128) {
-                    SDL_PutAudioStreamData(musicStream, it2->second.buffer, (int)it2->second.length);
+                    SDL_PutAudioStreamData(musicStream, data.buffer, (int)data.length);
                 } else {
-                    Uint8* temp = (Uint8*)SDL_malloc(it2->second.length);
+                    Uint8* temp = (Uint8*)SDL_malloc(data.length);
                     if (temp) {
-                        mixAudioFormat(temp, it2->second.buffer, deviceSpec.format, (int)it2->second.length, musicVolume);
-                        SDL_PutAudioStreamData(musicStream, temp, (int)it2->second.length);
+                        mixAudioFormat(temp, data.buffer, deviceSpec.format, (int)data.length, musicVolume);
+                        SDL_PutAudioStreamData(musicStream, temp, (int)data.length);
                         SDL_free(temp);
                     }
                 }
@@ -1,8 +1,13 @@
 #pragma once
 #include <string>
-#include <unordered_map>
 #include <vector>
 #include <SDL3/SDL.h>
+#include "Random.h"
+
+// Interned sound name: an index into Sound's per-sound tables.
+// Resolve names once (Sound::intern or the Sfx constants below) and play by handle.
+using SfxId = int;
+constexpr SfxId NO_SFX = -1;
 
 class Sound {
 public:
@@ -12,13 +17,18 @@ public:
     bool init();
     void shutdown();
 
+    // Same name always gives the same handle; works before init() so handles can be static constants
+    static SfxId intern(const std::string& name);
+    static const std::string& nameOf(SfxId id);
+
     bool loadWav(const std::string& id, const std::string& path);
     // allowOverlap=false prevents starting a new instance while one is playing
     // minIntervalMs specifies minimum milliseconds between plays of the same id (0 = no limit)
-    void playSfx(const std::string& id, int volume = 128, bool allowOverlap = false, int minIntervalMs = 0);
-    void stopSfx(const std::string& id);
+    void playSfx(SfxId id, int volume = 128, bool allowOverlap = false, int minIntervalMs = 0);
+    void stopSfx(SfxId id);
     void stopAllSfx();
-    void playMusic(const std::string& id, bool loop = true, int volume = 128);
+    void playMusic(SfxId id, bool loop = true, int volume = 128);
+    void playMusic(const std::string& id, bool loop = true, int volume = 128) { playMusic(intern(id), loop, volume); }
     void stopMusic();
 
     // music mute control
@@ -32,7 +42,7 @@ public:
     bool isMusicPlaying() const;
 
     static int randomInt(int min, int max) {
-        return rand() % (max - min + 1) + min;
+        return gRng.sound.range(min, max);
     }
 private:
     struct AudioData {
@@ -41,26 +51,44 @@ private:
         SDL_AudioSpec spec{};    // format of buffer (should match deviceSpec)
     };
 
-    std::unordered_map<std::string, AudioData> loaded;
+    // Everything known about one sound, indexed by SfxId
+    struct Slot {
+        AudioData data;
+        bool loaded = false;
+        bool played = false;        // lastPlayTimeMs is valid
+        Uint32 lastPlayTimeMs = 0;  // enforces minIntervalMs
+        std::vector<SDL_AudioStream*> playing; // live instances (may be several)
+    };
+    std::vector<Slot> slots;
+    Slot& slot(SfxId id);
 
     SDL_AudioDeviceID device = 0;
     SDL_AudioSpec deviceSpec{};
     int deviceSampleFrames = 0;
 
-    std::vector<SDL_AudioStream*> activeStreams;
-    // Track which SFX ids are currently playing (allow multiple streams per id)
-    std::unordered_map<std::string, std::vector<SDL_AudioStream*>> playingSfx;
-
-    // track last play time (ms) for each sfx id to enforce min interval
-    std::unordered_map<std::string, Uint32> lastPlayTimeMs;
+    // each sfx stream remembers its id so cleanup goes straight to the owning slot
+    struct ActiveStream {
+        SDL_AudioStream* stream;
+        SfxId id;
+    };
+    std::vector<ActiveStream> activeStreams;
 
     // music-specific
     SDL_AudioStream* musicStream = nullptr;
-    std::string musicId;
+    SfxId musicId = NO_SFX;
     bool musicLoop = false;
     int musicVolume = 128;
     bool musicMuted = false;
 };
 
+// Handles for the sounds gameplay code triggers
+namespace Sfx {
+    extern const SfxId HIT, ORC_HIT, WALK, DEATH, ORC_DEATH, HEARTBEAT;
+    extern const SfxId STEP, JUMP1, JUMP2, ATTACK1, ATTACK2, ATTACK3, CHARGE_START, CHARGE_DASH;
+    extern const SfxId FALLTRAP_RELEASE, FALLTRAP_LAND, FALL_PLAT, CLANG;
+    extern const SfxId ARROW, ARROW_IMPACT, ARROW_EMPTY, MONSTER, ORC_LAUGH;
+    extern const SfxId LOCK_OPEN, LOCK_FAIL, DOOR_OPEN;
+}
+
 // Global pointer set by Engine to allow easy SFX calls from gameplay code
 extern Sound* gSound;
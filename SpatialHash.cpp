@@ -0,0 +1,124 @@
+#include "SpatialHash.h"
+#include "GameObject.h"
+#include "MapObject.h"
+#include <algorithm>
+#include <cmath>
+
+void SpatialHash::reset(int worldW, int worldH, int cellSize_, float slop_)
+{
+    cellSize = std::max(1, cellSize_);
+    slop = slop_;
+    cols = std::max(1, (worldW + cellSize - 1) / cellSize);
+    rows = std::max(1, (worldH + cellSize - 1) / cellSize);
+    entries.clear();
+    cellItems.clear();
+    cellStart.assign(size_t(cols) * rows + 1, 0);
+}
+
+void SpatialHash::clear()
+{
+    entries.clear();
+    cellItems.clear();
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+}
+
+void SpatialHash::insert(GameObject* actor, Kind kind)
+{
+    if (!actor) return;
+    insert(actor, kind, actor->getRect(), actor->getAttackRect());
+}
+
+void SpatialHash::insert(GameObject* actor, Kind kind, const SDL_FRect& body, const SDL_FRect& atk)
+{
+    SDL_FRect r = body;
+    if (atk.w > 0.0f && atk.h > 0.0f) {
+        float x0 = std::min(r.x, atk.x), y0 = std::min(r.y, atk.y);
+        float x1 = std::max(r.x + r.w, atk.x + atk.w), y1 = std::max(r.y + r.h, atk.y + atk.h);
+        r = { x0, y0, x1 - x0, y1 - y0 };
+    }
+    push(kind, actor, nullptr, r);
+}
+
+void SpatialHash::insert(MapObject* object)
+{
+    if (!object || !object->active) return;
+    push(object->getBroadphaseKind(), nullptr, object, object->getRect());
+}
+
+void SpatialHash::push(Uint8 kind, GameObject* actor, MapObject* object, SDL_FRect rect)
+{
+    Entry e;
+    e.kind = kind;
+    e.actor = actor;
+    e.object = object;
+    e.rect = { rect.x - slop, rect.y - slop, rect.w + slop * 2.0f, rect.h + slop * 2.0f };
+    entries.push_back(e);
+}
+
+bool SpatialHash::cellRange(const SDL_FRect& r, int& c0, int& r0, int& c1, int& r1) const
+{
+    c0 = int(std::floor(r.x / cellSize));
+    r0 = int(std::floor(r.y / cellSize));
+    c1 = int(std::floor((r.x + r.w) / cellSize));
+    r1 = int(std::floor((r.y + r.h) / cellSize));
+    if (c1 < 0 || r1 < 0 || c0 >= cols || r0 >= rows) return false;
+    c0 = std::max(c0, 0);
+    r0 = std::max(r0, 0);
+    c1 = std::min(c1, cols - 1);
+    r1 = std::min(r1, rows - 1);
+    return true;
+}
+
+void SpatialHash::build()
+{
+    if (cellStart.size() != size_t(cols) * rows + 1) cellStart.assign(size_t(cols) * rows + 1, 0);
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+
+    // counting sort: count entries per cell, prefix-sum into offsets, then scatter
+    int c0, r0, c1, r1;
+    for (const Entry& e : entries) {
+        if (!cellRange(e.rect, c0, r0, c1, r1)) continue;
+        for (int cy = r0; cy <= r1; ++cy)
+            for (int cx = c0; cx <= c1; ++cx)
+                ++cellStart[cy * cols + cx + 1];
+    }
+    for (size_t i = 1; i < cellStart.size(); ++i) cellStart[i] += cellStart[i - 1];
+
+    cellItems.resize(cellStart.back());
+    std::vector<int>& fill = scratchFill;
+    fill.assign(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < (int)entries.size(); ++i) {
+        if (!cellRange(entries[i].rect, c0, r0, c1, r1)) continue;
+        for (int cy = r0; cy <= r1; ++cy)
+            for (int cx = c0; cx <= c1; ++cx)
+                cellItems[fill[cy * cols + cx]++] = i;
+    }
+}
+
+void SpatialHash::query(const SDL_FRect& rect, unsigned mask, std::vector<Entry*>& out)
+{
+    out.clear();
+    int c0, r0, c1, r1;
+    if (entries.empty() || !cellRange(rect, c0, r0, c1, r1)) return;
+
+    if (++queryStamp == 0) {
+        // stamp wrapped: forget old marks so nothing is skipped by accident
+        for (Entry& e : entries) e.stamp = 0;
+        queryStamp = 1;
+    }
+
+    for (int cy = r0; cy <= r1; ++cy) {
+        for (int cx = c0; cx <= c1; ++cx) {
+            int cell = cy * cols + cx;
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                Entry& e = entries[cellItems[k]];
+                if (e.stamp == queryStamp || !(e.kind & mask)) continue;
+                e.stamp = queryStamp;
+                if (!SDL_HasRectIntersectionFloat(&rect, &e.rect)) continue;
+                out.push_back(&e);
+            }
+        }
+    }
+    // entries are contiguous, so pointer order is insertion order
+    std::sort(out.begin(), out.end());
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+class GameObject;
+class MapObject;
+
+// Uniform-grid broadphase over the current level.
+// Actors (player/orcs/archers) and map objects are re-inserted every tick; queries only
+// visit the cells a rect touches, so interaction cost follows local density instead of
+// the objects x entities product. Results are candidates: callers still do the exact test.
+class SpatialHash {
+public:
+    enum Kind : Uint8 {
+        PLAYER = 1 << 0,
+        ORC = 1 << 1,
+        ARCHER = 1 << 2,
+        OBJECT = 1 << 3,   // any map object not listed below
+        CRATE = 1 << 4,    // object is a Crate
+        DOOR = 1 << 5,     // object is a Door
+
+        ENEMY = ORC | ARCHER,
+        ACTOR = PLAYER | ORC | ARCHER,
+        MAPOBJECT = OBJECT | CRATE | DOOR,
+        ALL = 0xFF
+    };
+
+    struct Entry {
+        Uint8 kind = 0;
+        GameObject* actor = nullptr;   // set for PLAYER/ORC/ARCHER
+        MapObject* object = nullptr;   // set for OBJECT/CRATE/DOOR
+        SDL_FRect rect{ 0, 0, 0, 0 };  // bounds at insert time, inflated by the slop margin
+        Uint32 stamp = 0;              // last query that returned this entry (de-duplication)
+    };
+
+    // Size the grid for a world of worldW x worldH pixels and drop all entries.
+    // `slop` inflates inserted bounds so things that move a little after the rebuild
+    // (crates, knocked-back enemies) are still found.
+    void reset(int worldW, int worldH, int cellSize = 32, float slop = 8.0f);
+
+    // Start a new rebuild: remove all entries but keep the grid
+    void clear();
+
+    // Actors are inserted with their body plus current attack hitbox
+    void insert(GameObject* actor, Kind kind);
+    // Same, from bounds the caller already has (e.g. from EnemyState)
+    void insert(GameObject* actor, Kind kind, const SDL_FRect& body, const SDL_FRect& attack);
+    // Map objects go in under their own getBroadphaseKind()
+    void insert(MapObject* object);
+
+    // Bin the inserted entries into cells; call once after the inserts
+    void build();
+
+    // Collect entries of the given kinds whose bounds touch `rect`, each at most once and
+    // in insertion order (player, orcs, archers, objects). `out` is cleared first.
+    void query(const SDL_FRect& rect, unsigned mask, std::vector<Entry*>& out);
+
+    int getEntryCount() const { return (int)entries.size(); }
+
+private:
+    void push(Uint8 kind, GameObject* actor, MapObject* object, SDL_FRect rect);
+    // Clamp a world rect to the cell range it covers; false if it lies off the grid
+    bool cellRange(const SDL_FRect& r, int& c0, int& r0, int& c1, int& r1) const;
+
+    int cols = 1, rows = 1;
+    int cellSize = 32;
+    float slop = 8.0f;
+    Uint32 queryStamp = 0;
+
+    std::vector<Entry> entries;
+    // flat bins: cell i owns cellItems[cellStart[i] .. cellStart[i + 1])
+    std::vector<int> cellStart;
+    std::vector<int> cellItems;
+    std::vector<int> scratchFill; // per-cell write cursor used by build()
+};
@@ -0,0 +1,201 @@
+#include "SpawnRegistry.h"
+#include "Engine.h"
+#include "Archer.h"
+#include "ArrowTrap.h"
+#include "Checkpoint.h"
+#include "Crate.h"
+#include "Door.h"
+#include "FallingPlatform.h"
+#include "Spikes.h"
+#include <array>
+
+namespace SpawnRegistry {
+
+// --------------------------------------------------
+// Factories
+// --------------------------------------------------
+
+static void spawnOrc(Engine& e, const Context& c)
+{
+    e.orc.push_back(e.prototypes.spawnOrc(e.levelArena, c.tile, c.px, c.py));
+}
+
+static void spawnArcher(Engine& e, const Context& c)
+{
+    e.archers.push_back(e.prototypes.spawnArcher(e.levelArena, c.px, c.py));
+}
+
+static void spawnCheckpoint(Engine& e, const Context& c)
+{
+    Checkpoint* cp = e.levelArena.make<Checkpoint>(c.tx, c.ty, c.tile);
+    cp->setLevel(c.levelID);
+    // Only move the player's spawn to the checkpoint position if we're currently respawning from a checkpoint
+    // (i.e., the player died and selected Restart). This prevents normal portal transitions from using checkpoints.
+    if (e.respawnFromCheckpoint && c.levelID == e.lastCheckpointLevel) {
+        e.player->obj->x = c.px;
+        e.player->obj->y = c.py;
+    }
+    e.objects.push_back(cp);
+}
+
+static void spawnFallingTrap(Engine& e, const Context& c)
+{
+    e.fallT.push_back(e.levelArena.make<FallingTrap>(e.renderer, c.tx, c.ty));
+}
+
+static void spawnSpikes(Engine& e, const Context& c)
+{
+    e.objects.push_back(e.levelArena.make<Spikes>(c.tx, c.ty, c.tile));
+}
+
+static void spawnPressurePlate(Engine& e, const Context& c)
+{
+    PressurePlate* pp = e.levelArena.make<PressurePlate>(c.tx, c.ty, c.tile);
+    // Configure per-level plate behavior. Use levelID to decide what this plate should do.
+    // Example mapping: add cases here to customize behavior per level and per-plate coords.
+    switch (c.levelID) {
+    case 43:
+        // In level 22, all pressure plates fire nearby arrow traps
+        pp->setTargetAction(PressurePlate::TargetAction::FIRE_ARROWTRAPS);
+        break;
+    case 22:
+        // In level 22, all pressure plates fire nearby arrow traps
+        pp->setTargetAction(PressurePlate::TargetAction::FIRE_ARROWTRAPS);
+        break;
+    case 222:
+        // In level 24, a specific plate opens a door at (tx,ty)
+        if (c.tx == 12 && c.ty == 4) {
+            pp->setTargetAction(PressurePlate::TargetAction::OPEN_DOOR, 13, 4);
+        }
+        break;
+    case 228:
+        // In level 28, a plate drops a falling trap at specific coords
+        if (c.tx == 9 && c.ty == 7) {
+            pp->setTargetAction(PressurePlate::TargetAction::DROP_FALLINGTRAP, 10, 7);
+        }
+        break;
+    default:
+        // leave as NONE by default
+        break;
+    }
+
+    // Pressure plate sprite should be positioned at tile top; no vertical offset necessary
+    e.objects.push_back(pp);
+    e.plates.push_back(pp);
+}
+
+static void spawnArrowTrap(Engine& e, const Context& c)
+{
+    ArrowTrap* at = e.levelArena.make<ArrowTrap>(e.renderer, c.tx, c.ty, c.tile);
+    if (c.levelID == 44) at->setAutoFire(true);
+    e.objects.push_back(at);
+    e.arrowTraps.push_back(at);
+}
+
+static void spawnDoor(Engine& e, const Context& c)
+{
+    Door* d = e.levelArena.make<Door>(c.tx, c.ty, c.tile);
+    // load door animation: assume sprite "Assets/Sprites/door.png" with frames horizontally
+    if (!d->loadAnimation(e.renderer, "Assets/Sprites/door.png", 32, 48, 8, 0, 0, 0, 32, 48, 8)) {
+        SDL_Log("Failed to load door animation");
+    }
+    // set level for persistence and restore opened state if previously opened
+    d->setLevel(c.levelID);
+    if (e.isDoorOpened(c.levelID, c.tx, c.ty)) {
+        d->open(false); // open silently without SFX when restoring state
+    }
+    e.objects.push_back(d);
+    e.doors.push_back(d);
+}
+
+static void spawnKey(Engine& e, const Context& c)
+{
+    // Only spawn key object if it hasn't already been collected
+    if (e.isKeyCollected(c.levelID, c.tx, c.ty)) return;
+    // use default tile rendering (no animation) so tile from tileset is shown
+    e.objects.push_back(e.levelArena.make<MapObject>(c.tx, c.ty, c.tile));
+}
+
+static void spawnCrate(Engine& e, const Context& c)
+{
+    Crate* cr = e.levelArena.make<Crate>(c.tx, c.ty, c.tile);
+    e.objects.push_back(cr);
+    e.crates.push_back(cr);
+}
+
+static void spawnPlatform(Engine& e, const Context& c)
+{
+    if (c.run) e.objects.push_back(e.levelArena.make<FallingPlatform>(c.tx, c.ty, *c.run));
+    else e.objects.push_back(e.levelArena.make<FallingPlatform>(c.tx, c.ty, std::vector<int>{ c.tile }));
+}
+
+// --------------------------------------------------
+// Rule table
+// --------------------------------------------------
+
+static constexpr std::array<Rule, MAX_TILE> buildRules()
+{
+    std::array<Rule, MAX_TILE> r{};
+    auto add = [&r](int tile, Factory f, Uint8 flags = SPAWNS) { r[tile] = { f, flags }; };
+
+    // the player is placed by loadLevel itself (portals / SPAWN_PLAYER)
+    add(Map::SPAWN_ORC, spawnOrc);
+    add(Map::SPAWN_SLIME, spawnOrc);
+    add(Map::SPAWN_SKELETON, spawnOrc);
+    add(Map::SPAWN_ARCHER, spawnArcher);
+    add(Map::SPAWN_CHECKPOINT, spawnCheckpoint);
+    add(Map::SPAWN_FALLINGTRAP, spawnFallingTrap);
+    add(Map::SPAWN_SPIKES, spawnSpikes);
+    add(Map::SPAWN_PRESSURE_PLATE, spawnPressurePlate);
+    add(Map::SPAWN_ARROWTRAP_LEFT, spawnArrowTrap);
+    add(Map::SPAWN_ARROWTRAP_RIGHT, spawnArrowTrap);
+    add(Map::SPAWN_DOOR, spawnDoor);
+    add(Map::SPAWN_KEY, spawnKey);
+    add(Map::SPAWN_CRATE, spawnCrate);
+
+    // falling platforms: left edge, any number of middles, optional right edge
+    add(Map::SPAWN_PLATFORM_LEFT, spawnPlatform, SPAWNS | RUN_START);
+    add(Map::SPAWN_PLATFORM_MID, nullptr, RUN_PART);
+    add(Map::SPAWN_PLATFORM_RIGHT, nullptr, RUN_PART | RUN_END);
+    add(Map::SPAWN_PLATFORM_SINGLE, spawnPlatform);
+    return r;
+}
+
+static constexpr std::array<Rule, MAX_TILE> kRules = buildRules();
+
+const Rule& rule(int tile)
+{
+    static const Rule none;
+    return (unsigned)tile < (unsigned)MAX_TILE ? kRules[tile] : none;
+}
+
+void spawnAll(Engine& engine, int levelID)
+{
+    const Map& map = engine.map;
+    std::vector<int> run;
+    for (const auto& s : map.getObjectSpawns()) {
+        const Rule& r = rule(s.tileIndex);
+        Context ctx;
+        ctx.levelID = levelID;
+        ctx.tx = s.x;
+        ctx.ty = s.y;
+        ctx.tile = s.tileIndex;
+        ctx.px = float(s.x * Map::TILE_SIZE);
+        ctx.py = float(s.y * Map::TILE_SIZE);
+
+        if (r.flags & RUN_START) {
+            // group the tiles to the right that continue this run
+            run.assign(1, s.tileIndex);
+            for (int x = s.x + 1; x < map.width; ++x) {
+                Uint8 f = rule(map.spawn[s.y * map.width + x]).flags;
+                if (!(f & RUN_PART)) break;
+                run.push_back(map.spawn[s.y * map.width + x]);
+                if (f & RUN_END) break;
+            }
+            ctx.run = &run;
+        }
+        r.spawn(engine, ctx);
+    }
+}
+
+}
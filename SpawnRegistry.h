@@ -0,0 +1,43 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+class Engine;
+
+// What each spawn-layer tile ID turns into when a level loads.
+// The rule table is built at compile time over the tile-ID range, so the Map scan and the
+// Engine dispatch are one array lookup per tile. Adding an entity type means writing its
+// factory and adding one row to the table in SpawnRegistry.cpp.
+namespace SpawnRegistry {
+
+    // Everything a factory gets about the spawn
+    struct Context {
+        int levelID = 0;
+        int tx = 0, ty = 0;                    // spawn tile
+        int tile = 0;                          // spawn tile value
+        float px = 0.0f, py = 0.0f;            // tile top-left in world pixels
+        const std::vector<int>* run = nullptr; // grouped tile values, for RUN_START rules
+    };
+    using Factory = void (*)(Engine& engine, const Context& ctx);
+
+    enum Flags : Uint8 {
+        SPAWNS = 1 << 0,    // instantiated by loadLevel (listed by Map::getObjectSpawns)
+        RUN_START = 1 << 1, // begins a horizontal run; the factory gets the grouped tiles
+        RUN_PART = 1 << 2,  // may continue a run to its right
+        RUN_END = 1 << 3,   // closes a run
+    };
+
+    struct Rule {
+        Factory spawn = nullptr;
+        Uint8 flags = 0;
+    };
+
+    // Spawn tile IDs are below this; larger values have no rule
+    constexpr int MAX_TILE = 1024;
+
+    const Rule& rule(int tile);
+    inline bool spawns(int tile) { return (rule(tile).flags & SPAWNS) != 0; }
+
+    // Instantiate every object spawn of the engine's current map
+    void spawnAll(Engine& engine, int levelID);
+}
@@ -6,6 +6,7 @@
 Spikes::Spikes(int tileX, int tileY, int tileIndex)
     : MapObject(tileX, tileY, tileIndex)
 {
+    tracked.setOwner("Spikes");
 }
 
 Spikes::~Spikes() = default;
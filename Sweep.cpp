@@ -0,0 +1,60 @@
+#include "Sweep.h"
+#include <algorithm>
+#include <limits>
+
+bool sweptAABB(const SDL_FRect& box, float dx, float dy, const SDL_FRect& target,
+               float& t, float* nx, float* ny)
+{
+    if (nx) *nx = 0.0f;
+    if (ny) *ny = 0.0f;
+
+    // already overlapping
+    if (box.x < target.x + target.w && box.x + box.w > target.x &&
+        box.y < target.y + target.h && box.y + box.h > target.y) {
+        t = 0.0f;
+        return true;
+    }
+
+    const float inf = std::numeric_limits<float>::infinity();
+    float enterX, exitX, enterY, exitY;
+
+    if (dx > 0.0f) {
+        enterX = (target.x - (box.x + box.w)) / dx;
+        exitX = (target.x + target.w - box.x) / dx;
+    } else if (dx < 0.0f) {
+        enterX = (target.x + target.w - box.x) / dx;
+        exitX = (target.x - (box.x + box.w)) / dx;
+    } else {
+        if (box.x + box.w <= target.x || box.x >= target.x + target.w) return false;
+        enterX = -inf;
+        exitX = inf;
+    }
+
+    if (dy > 0.0f) {
+        enterY = (target.y - (box.y + box.h)) / dy;
+        exitY = (target.y + target.h - box.y) / dy;
+    } else if (dy < 0.0f) {
+        enterY = (target.y + target.h - box.y) / dy;
+        exitY = (target.y - (box.y + box.h)) / dy;
+    } else {
+        if (box.y + box.h <= target.y || box.y >= target.y + target.h) return false;
+        enterY = -inf;
+        exitY = inf;
+    }
+
+    float enter = std::max(enterX, enterY);
+    float exit = std::min(exitX, exitY);
+    if (enter >= exit || enter < 0.0f || enter > 1.0f) return false;
+
+    t = enter;
+    if (enterX > enterY) { if (nx) *nx = dx > 0.0f ? -1.0f : 1.0f; }
+    else { if (ny) *ny = dy > 0.0f ? -1.0f : 1.0f; }
+    return true;
+}
+
+SDL_FRect sweptBounds(const SDL_FRect& box, float dx, float dy)
+{
+    float x0 = std::min(box.x, box.x + dx);
+    float y0 = std::min(box.y, box.y + dy);
+    return { x0, y0, box.w + (dx < 0.0f ? -dx : dx), box.h + (dy < 0.0f ? -dy : dy) };
+}
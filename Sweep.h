@@ -0,0 +1,14 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// Swept AABB helpers for things that can move more than their own size in one tick.
+
+// Does `box` moving by (dx, dy) touch `target` during the move (slab method)?
+// On a hit `t` is the entry time in [0, 1] (0 when they already overlap) and (nx, ny)
+// the contact normal on `target` (zero when they already overlap).
+// Boxes that only slide along each other's edges do not count as touching.
+bool sweptAABB(const SDL_FRect& box, float dx, float dy, const SDL_FRect& target,
+               float& t, float* nx = nullptr, float* ny = nullptr);
+
+// Bounds covering `box` over the whole move
+SDL_FRect sweptBounds(const SDL_FRect& box, float dx, float dy);
@@ -0,0 +1,75 @@
+#include "UiLayer.h"
+#include "ResourceTracker.h"
+#include <cmath>
+
+UiLayer::UiLayer(float w_, float h_, float viewScale_)
+    : w(w_), h(h_), viewScale(viewScale_ > 0.0f ? viewScale_ : 1.0f)
+{
+}
+
+UiLayer::~UiLayer()
+{
+    if (texture) {
+        ResourceTracker::destroyTexture(texture);
+        texture = nullptr;
+    }
+}
+
+void UiLayer::resize(float w_, float h_)
+{
+    bool samePixels = std::ceil(w_ * viewScale) == std::ceil(w * viewScale)
+        && std::ceil(h_ * viewScale) == std::ceil(h * viewScale);
+    w = w_;
+    h = h_;
+    if (!samePixels && texture) {
+        ResourceTracker::destroyTexture(texture);
+        texture = nullptr;
+    }
+    dirty = true;
+}
+
+bool UiLayer::begin(SDL_Renderer* renderer)
+{
+    if (!renderer || w <= 0.0f || h <= 0.0f) return false;
+
+    if (!texture) {
+        int pw = (int)std::ceil(w * viewScale);
+        int ph = (int)std::ceil(h * viewScale);
+        texture = ResourceTracker::track(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, pw, ph), "UiLayer", ResourceTracker::SESSION);
+        if (!texture) {
+            SDL_Log("UiLayer: failed to create %dx%d target: %s", pw, ph, SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+        // content is composited onto transparent black, i.e. it ends up premultiplied
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    }
+
+    prevTarget = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, texture)) {
+        SDL_Log("UiLayer: failed to set render target: %s", SDL_GetError());
+        return false;
+    }
+    // each target keeps its own view; match the scale the owner normally draws with
+    SDL_SetRenderScale(renderer, viewScale, viewScale);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    return true;
+}
+
+void UiLayer::end(SDL_Renderer* renderer)
+{
+    SDL_SetRenderTarget(renderer, prevTarget);
+    prevTarget = nullptr;
+    dirty = false;
+}
+
+void UiLayer::draw(SDL_Renderer* renderer, float x, float y, Uint8 alpha)
+{
+    if (!renderer || !texture) return;
+    // premultiplied: fade colour and alpha together
+    SDL_SetTextureColorMod(texture, alpha, alpha, alpha);
+    SDL_SetTextureAlphaMod(texture, alpha);
+    SDL_FRect dst{ x, y, w, h };
+    SDL_RenderTexture(renderer, texture, nullptr, &dst);
+}
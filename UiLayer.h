@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// Retained UI layer: caches a composited piece of UI in a render-target texture.
+// Owners redraw into it only when their state changes (invalidate()) and otherwise
+// blit the cached texture with a single draw call.
+//
+// Sizes are given in the owner's draw units; `viewScale` is the render scale the
+// layer will be presented under, so the cache is rasterised at final pixel density.
+class UiLayer {
+public:
+    UiLayer(float w, float h, float viewScale = 1.0f);
+    ~UiLayer();
+
+    void invalidate() { dirty = true; }
+    bool isDirty() const { return dirty || !texture; }
+
+    // Resize the layer (drops the cached texture if the pixel size changes)
+    void resize(float w, float h);
+
+    // Redirect rendering into the cache and clear it. Returns false when render
+    // targets are unavailable; the caller should then draw directly to the screen.
+    bool begin(SDL_Renderer* renderer);
+    void end(SDL_Renderer* renderer);
+
+    // Draw the cached texture with its top-left at (x, y)
+    void draw(SDL_Renderer* renderer, float x, float y, Uint8 alpha = 255);
+
+    float getWidth() const { return w; }
+    float getHeight() const { return h; }
+
+private:
+    float w = 0.0f, h = 0.0f;
+    float viewScale = 1.0f;
+    SDL_Texture* texture = nullptr;
+    SDL_Texture* prevTarget = nullptr;
+    bool dirty = true;
+};
@@ -1,4 +1,5 @@
 #include "WorldObject.h"
+#include "ResourceTracker.h"
 #include <SDL3_image/SDL_image.h>
 
 WorldObject::WorldObject(SDL_Renderer* renderer,
@@ -13,14 +14,14 @@ WorldObject::WorldObject(SDL_Renderer* renderer,
         return;
     }
 
-    texture = SDL_CreateTextureFromSurface(renderer, surf);
+    texture = ResourceTracker::track(SDL_CreateTextureFromSurface(renderer, surf), "WorldObject");
     SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
     SDL_DestroySurface(surf);
 }
 
 WorldObject::~WorldObject() {
     if (texture)
-        SDL_DestroyTexture(texture);
+        ResourceTracker::destroyTexture(texture);
 }
 
 void WorldObject::draw(SDL_Renderer* renderer, int camX, int camY) {
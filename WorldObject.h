@@ -1,6 +1,7 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include <string>
+#include "ResourceTracker.h"
 
 class WorldObject {
 public:
@@ -21,4 +22,5 @@ public:
 
 protected:
     SDL_Texture* texture = nullptr;
+    ResourceTracker::Token tracked{ ResourceTracker::ENTITY, "WorldObject" };
 };